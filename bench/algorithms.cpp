@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/buffer.hpp>
+#include <boost/buffers/buffer_pair.hpp>
+#include <boost/buffers/copy.hpp>
+#include <boost/buffers/slice.hpp>
+#include <boost/buffers/to_string.hpp>
+#include <boost/core/span.hpp>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+// Benchmarks for the algorithms in buffer.hpp,
+// copy.hpp, slice.hpp and to_string.hpp over
+// a fixed payload split into various shapes.
+struct algorithms_bench
+{
+    static constexpr std::size_t payload = 64 * 1024;
+
+    // typical MSS, for partial write loops
+    static constexpr std::size_t chunk = 1460;
+
+    std::string src_ = std::string(payload, 'x');
+    std::string dest_ = std::string(payload, '\0');
+
+    // Split the payload into n equal segments
+    std::vector<const_buffer>
+    segments(std::size_t n) const
+    {
+        std::vector<const_buffer> v;
+        v.reserve(n);
+        auto const len = payload / n;
+        for(std::size_t i = 0; i < n; ++i)
+            v.emplace_back(src_.data() + i * len, len);
+        return v;
+    }
+
+    template<class BufferSequence>
+    void
+    run_shape(
+        runner& r,
+        std::string const& shape,
+        BufferSequence const& bs)
+    {
+        auto const n = size(bs);
+        mutable_buffer const dest(&dest_[0], dest_.size());
+
+        r.measure("copy/" + shape, n, [&]
+        {
+            do_not_optimize(copy(dest, bs));
+        });
+
+        r.measure("size/" + shape, 0, [&]
+        {
+            do_not_optimize(size(bs));
+        });
+
+        r.measure("length/" + shape, 0, [&]
+        {
+            do_not_optimize(length(bs));
+        });
+
+        r.measure("to_string/" + shape, n, [&]
+        {
+            do_not_optimize(to_string(bs));
+        });
+
+        r.measure("prefix/" + shape, 0, [&]
+        {
+            do_not_optimize(prefix(bs, n / 2));
+        });
+
+        r.measure("sans_prefix/" + shape, 0, [&]
+        {
+            do_not_optimize(sans_prefix(bs, n / 2));
+        });
+
+        r.measure("suffix/" + shape, 0, [&]
+        {
+            do_not_optimize(suffix(bs, n / 2));
+        });
+
+        r.measure("sans_suffix/" + shape, 0, [&]
+        {
+            do_not_optimize(sans_suffix(bs, n / 2));
+        });
+
+        // a partial write loop: the sequence is
+        // trimmed from the front one chunk at a time
+        r.measure("remove_prefix_loop/" + shape, n, [&]
+        {
+            slice_type<BufferSequence> s(bs);
+            for(std::size_t left = n; left > 0;)
+            {
+                std::size_t k = chunk;
+                if(k > left)
+                    k = left;
+                remove_prefix(s, k);
+                left -= k;
+            }
+            do_not_optimize(s);
+        });
+    }
+
+    void
+    run(runner& r)
+    {
+        run_shape(r, "buffer",
+            const_buffer(src_.data(), src_.size()));
+
+        {
+            auto const v = segments(2);
+            run_shape(r, "pair",
+                const_buffer_pair{{ v[0], v[1] }});
+        }
+
+        for(std::size_t n : { 2, 16, 256, 4096 })
+        {
+            auto const v = segments(n);
+            run_shape(r, "span_" + std::to_string(n),
+                span<const_buffer const>(v.data(), v.size()));
+        }
+
+        for(std::size_t n : { 16, 256 })
+        {
+            auto const v = segments(n);
+            run_shape(r, "list_" + std::to_string(n),
+                std::list<const_buffer>(v.begin(), v.end()));
+        }
+    }
+};
+
+BENCH_SUITE(algorithms_bench, "algorithms");
+
+} // bench
+} // buffers
+} // boost
@@ -0,0 +1,233 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/any_buffers.hpp>
+#include <boost/buffers/copy.hpp>
+#include <boost/core/span.hpp>
+
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+namespace {
+
+// A sequence whose iterator is too big for
+// the small buffer optimization in any_buffers
+class fat_sequence
+{
+    std::list<const_buffer> const* v_;
+
+public:
+    class const_iterator
+    {
+        std::list<const_buffer>::const_iterator it_;
+        unsigned char pad_[64] = {};
+
+    public:
+        using value_type = const_buffer;
+        using reference = const_buffer;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category =
+            std::bidirectional_iterator_tag;
+
+        const_iterator() = default;
+
+        explicit
+        const_iterator(
+            std::list<const_buffer>::const_iterator it) noexcept
+            : it_(it)
+        {
+        }
+
+        bool
+        operator==(const_iterator const& other) const noexcept
+        {
+            return it_ == other.it_;
+        }
+
+        bool
+        operator!=(const_iterator const& other) const noexcept
+        {
+            return it_ != other.it_;
+        }
+
+        reference
+        operator*() const noexcept
+        {
+            return *it_;
+        }
+
+        const_iterator&
+        operator++() noexcept
+        {
+            ++it_;
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) noexcept
+        {
+            auto temp = *this;
+            ++it_;
+            return temp;
+        }
+
+        const_iterator&
+        operator--() noexcept
+        {
+            --it_;
+            return *this;
+        }
+
+        const_iterator
+        operator--(int) noexcept
+        {
+            auto temp = *this;
+            --it_;
+            return temp;
+        }
+    };
+
+    explicit
+    fat_sequence(
+        std::list<const_buffer> const& v) noexcept
+        : v_(&v)
+    {
+    }
+
+    const_iterator
+    begin() const noexcept
+    {
+        return const_iterator(v_->begin());
+    }
+
+    const_iterator
+    end() const noexcept
+    {
+        return const_iterator(v_->end());
+    }
+};
+
+} // (anon)
+
+// Full passes over type-erased sequences. The
+// reported MB/s stays flat as the number of
+// segments grows when iteration is linear.
+struct any_buffers_bench
+{
+    static constexpr std::size_t segment = 64;
+
+    template<class BufferSequence>
+    static
+    void
+    iterate(
+        runner& r,
+        std::string const& name,
+        BufferSequence const& bs,
+        std::size_t bytes)
+    {
+        any_buffers<true> ab(bs);
+        r.measure(name, bytes, [&]
+        {
+            std::size_t n = 0;
+            auto const end = ab.end();
+            for(auto it = ab.begin(); it != end; ++it)
+                n += (*it).size();
+            do_not_optimize(n);
+        });
+    }
+
+    // The same pass using batches of 16
+    template<class BufferSequence>
+    static
+    void
+    fetch(
+        runner& r,
+        std::string const& name,
+        BufferSequence const& bs,
+        std::size_t bytes)
+    {
+        any_buffers<true> ab(bs);
+        r.measure(name, bytes, [&]
+        {
+            std::size_t n = 0;
+            const_buffer v[16];
+            auto it = ab.begin();
+            while(auto const k = ab.fetch(it, v, 16))
+                for(std::size_t i = 0; i < k; ++i)
+                    n += v[i].size();
+            do_not_optimize(n);
+        });
+    }
+
+    // Copying out of the erased sequence, which
+    // uses fetch to pull batches of buffers
+    template<class BufferSequence>
+    static
+    void
+    copy(
+        runner& r,
+        std::string const& name,
+        BufferSequence const& bs,
+        std::size_t bytes)
+    {
+        any_buffers<true> ab(bs);
+        std::string out(bytes, 0);
+        r.measure(name, bytes, [&]
+        {
+            auto const n = buffers::copy(
+                mutable_buffer(&out[0], out.size()), ab);
+            do_not_optimize(n);
+        });
+    }
+
+    void
+    run(runner& r)
+    {
+        for(std::size_t n : { 10, 100, 1000, 10000 })
+        {
+            std::string s(n * segment, 'x');
+            std::vector<const_buffer> v;
+            v.reserve(n);
+            for(std::size_t i = 0; i < n; ++i)
+                v.emplace_back(&s[i * segment], segment);
+
+            iterate(r, "any_buffers/small/" + std::to_string(n),
+                span<const_buffer const>(v.data(), v.size()),
+                s.size());
+            fetch(r, "any_buffers/small_fetch/" + std::to_string(n),
+                span<const_buffer const>(v.data(), v.size()),
+                s.size());
+            copy(r, "any_buffers/small_copy/" + std::to_string(n),
+                span<const_buffer const>(v.data(), v.size()),
+                s.size());
+            std::list<const_buffer> l(v.begin(), v.end());
+            iterate(r, "any_buffers/large/" + std::to_string(n),
+                fat_sequence(l), s.size());
+            fetch(r, "any_buffers/large_fetch/" + std::to_string(n),
+                fat_sequence(l), s.size());
+            copy(r, "any_buffers/large_copy/" + std::to_string(n),
+                fat_sequence(l), s.size());
+        }
+    }
+};
+
+BENCH_SUITE(any_buffers_bench, "any_buffers");
+
+} // bench
+} // buffers
+} // boost
@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_BENCH_BENCH_HPP
+#define BOOST_BUFFERS_BENCH_BENCH_HPP
+
+#include <boost/core/detail/string_view.hpp>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+// Keep the optimizer from discarding `t`
+template<class T>
+inline
+void
+do_not_optimize(T const& t) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(t) : "memory");
+#else
+    static char volatile sink;
+    sink = *reinterpret_cast<
+        char const volatile*>(&t);
+#endif
+}
+
+// One timed measurement
+struct result
+{
+    std::string name;
+    std::size_t iterations = 0;
+    std::size_t bytes = 0;      // processed per operation
+    double ns_per_op = 0;       // fastest sample
+    double ns_median = 0;       // median sample
+};
+
+// Runs measurements and collects the results
+class runner
+{
+    std::vector<result> results_;
+    std::string filter_;
+    std::chrono::nanoseconds min_time_;
+    int samples_;
+
+public:
+    explicit
+    runner(
+        std::string filter = {},
+        std::chrono::nanoseconds min_time =
+            std::chrono::milliseconds(20),
+        int samples = 5)
+        : filter_(std::move(filter))
+        , min_time_(min_time)
+        , samples_(samples)
+    {
+    }
+
+    std::vector<result> const&
+    results() const noexcept
+    {
+        return results_;
+    }
+
+    // Return true if `name` passes the filter
+    bool
+    enabled(
+        core::string_view name) const noexcept
+    {
+        return
+            filter_.empty() ||
+            name.find(filter_) != core::string_view::npos;
+    }
+
+    // Time `f`, which performs one operation
+    // touching `bytes` bytes each time it is called.
+    template<class F>
+    void
+    measure(
+        core::string_view name,
+        std::size_t bytes,
+        F&& f)
+    {
+        if(! enabled(name))
+            return;
+
+        using clock = std::chrono::steady_clock;
+
+        // calibrate
+        std::size_t n = 1;
+        for(;;)
+        {
+            auto const t0 = clock::now();
+            for(std::size_t i = 0; i < n; ++i)
+                f();
+            auto const t = clock::now() - t0;
+            if(t >= min_time_ || n >= (std::size_t(1) << 40))
+                break;
+            n *= 2;
+        }
+
+        std::vector<double> v;
+        v.reserve(samples_);
+        for(int j = 0; j < samples_; ++j)
+        {
+            auto const t0 = clock::now();
+            for(std::size_t i = 0; i < n; ++i)
+                f();
+            auto const t = clock::now() - t0;
+            v.push_back(static_cast<double>(
+                std::chrono::duration_cast<
+                    std::chrono::nanoseconds>(t).count()) / n);
+        }
+        add(name, n, bytes, std::move(v));
+    }
+
+    // Write the results as JSON
+    std::string
+    to_json() const;
+
+private:
+    void
+    add(
+        core::string_view name,
+        std::size_t iterations,
+        std::size_t bytes,
+        std::vector<double> v);
+};
+
+//------------------------------------------------
+
+// A registered group of benchmarks
+class suite
+{
+    char const* name_;
+    suite* next_;
+
+public:
+    explicit
+    suite(char const* name) noexcept;
+
+    virtual ~suite() = default;
+
+    char const*
+    name() const noexcept
+    {
+        return name_;
+    }
+
+    suite*
+    next() const noexcept
+    {
+        return next_;
+    }
+
+    virtual void run(runner&) = 0;
+};
+
+// Head of the list of registered suites
+suite*&
+suites() noexcept;
+
+template<class T>
+class suite_impl : public suite
+{
+public:
+    using suite::suite;
+
+    void
+    run(runner& r) override
+    {
+        T t;
+        t.run(r);
+    }
+};
+
+} // bench
+} // buffers
+} // boost
+
+#define BENCH_SUITE(type, name) \
+    static ::boost::buffers::bench::suite_impl<type> type##_instance_(name)
+
+#endif
@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/block_pool.hpp>
+
+#include <new>
+
+#include "bench.hpp"
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+// Allocate and free a burst of blocks, as a
+// connection growing and draining a buffer would
+struct block_pool_bench
+{
+    static constexpr std::size_t block = 4096;
+    static constexpr std::size_t burst = 16;
+
+    void
+    run(runner& r)
+    {
+        void* v[burst];
+
+        r.measure("block_pool/operator_new", 0, [&]
+        {
+            for(auto& p : v)
+                p = ::operator new(block);
+            do_not_optimize(v);
+            for(auto p : v)
+                ::operator delete(p);
+        });
+
+        block_pool pool(block);
+        r.measure("block_pool/pool", 0, [&]
+        {
+            for(auto& p : v)
+                p = pool.allocate();
+            do_not_optimize(v);
+            for(auto p : v)
+                pool.deallocate(p);
+        });
+    }
+};
+
+BENCH_SUITE(block_pool_bench, "block_pool");
+
+} // bench
+} // buffers
+} // boost
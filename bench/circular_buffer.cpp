@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/circular_buffer.hpp>
+#include <boost/buffers/pow2_circular_buffer.hpp>
+
+#include <string>
+
+#include "bench.hpp"
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+// Per-packet ring handling: each packet is
+// prepared, committed, inspected and consumed.
+// The packet size does not divide the capacity,
+// so the sequences regularly wrap around.
+struct circular_buffer_bench
+{
+    static constexpr std::size_t capacity = 64 * 1024;
+    static constexpr std::size_t packet = 1460;
+    static constexpr std::size_t packets = 4096;
+
+    std::string storage_ = std::string(capacity, '\0');
+
+    template<class Buffer>
+    void
+    packets_loop(
+        runner& r,
+        std::string const& name)
+    {
+        r.measure(name, packets * packet, [&]
+        {
+            Buffer cb(&storage_[0], storage_.size());
+            unsigned sum = 0;
+            for(std::size_t i = 0; i < packets; ++i)
+            {
+                auto const mb = cb.prepare(packet);
+                *static_cast<unsigned char*>(
+                    mb[0].data()) = 1;
+                cb.commit(packet);
+                auto const d = cb.data();
+                sum += *static_cast<
+                    unsigned char const*>(d[0].data());
+                cb.consume(d[0].size() + d[1].size());
+            }
+            do_not_optimize(sum);
+        });
+    }
+
+    // Keep the ring partly full so that reads and
+    // writes both wrap around
+    template<class Buffer>
+    void
+    backlog_loop(
+        runner& r,
+        std::string const& name)
+    {
+        r.measure(name, packets * packet, [&]
+        {
+            Buffer cb(&storage_[0], storage_.size());
+            cb.commit(size(cb.prepare(capacity / 2)));
+            unsigned sum = 0;
+            for(std::size_t i = 0; i < packets; ++i)
+            {
+                auto const mb = cb.prepare(packet);
+                *static_cast<unsigned char*>(
+                    mb[0].data()) = 1;
+                cb.commit(packet);
+                sum += *static_cast<
+                    unsigned char const*>(
+                        cb.data()[0].data());
+                cb.consume(packet);
+            }
+            do_not_optimize(sum);
+        });
+    }
+
+    void
+    run(runner& r)
+    {
+        packets_loop<circular_buffer>(
+            r, "circular_buffer/packets/modulo");
+        packets_loop<pow2_circular_buffer>(
+            r, "circular_buffer/packets/pow2");
+        backlog_loop<circular_buffer>(
+            r, "circular_buffer/backlog/modulo");
+        backlog_loop<pow2_circular_buffer>(
+            r, "circular_buffer/backlog/pow2");
+    }
+};
+
+BENCH_SUITE(circular_buffer_bench, "circular_buffer");
+
+} // bench
+} // buffers
+} // boost
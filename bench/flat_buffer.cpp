@@ -0,0 +1,77 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/flat_buffer.hpp>
+
+#include <cstdio>
+#include <string>
+
+#include "bench.hpp"
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+// A pipelined parser: reads arrive in chunks and
+// complete messages are consumed from the front,
+// leaving a partial message behind. Each variant
+// also prints the bytes moved per byte received.
+struct flat_buffer_bench
+{
+    static constexpr std::size_t capacity = 64 * 1024;
+    static constexpr std::size_t chunk = 1460;
+    static constexpr std::size_t message = 300;
+    static constexpr std::size_t total = 1024 * 1024;
+
+    std::string storage_ = std::string(capacity, '\0');
+
+    void
+    pipeline(
+        runner& r,
+        std::string const& name,
+        std::size_t threshold)
+    {
+        if(! r.enabled(name))
+            return;
+        std::size_t moved = 0;
+        r.measure(name, total, [&]
+        {
+            flat_buffer fb(&storage_[0], storage_.size());
+            fb.auto_compact(true, threshold);
+            for(std::size_t n = 0; n < total; n += chunk)
+            {
+                fb.commit(fb.prepare(chunk).size());
+                while(fb.size() >= message)
+                    fb.consume(message);
+            }
+            moved = fb.bytes_moved();
+            do_not_optimize(fb);
+        });
+        std::fprintf(stderr, "%-40s %12.3f moved/byte\n",
+            name.c_str(), static_cast<double>(moved) / total);
+    }
+
+    void
+    run(runner& r)
+    {
+        pipeline(r, "flat_buffer/pipeline/on_demand",
+            std::size_t(-1));
+        pipeline(r, "flat_buffer/pipeline/threshold_32k",
+            32 * 1024);
+        pipeline(r, "flat_buffer/pipeline/threshold_4k",
+            4 * 1024);
+        pipeline(r, "flat_buffer/pipeline/threshold_0", 0);
+    }
+};
+
+BENCH_SUITE(flat_buffer_bench, "flat_buffer");
+
+} // bench
+} // buffers
+} // boost
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include "bench.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+suite::
+suite(char const* name) noexcept
+    : name_(name)
+    , next_(suites())
+{
+    suites() = this;
+}
+
+suite*&
+suites() noexcept
+{
+    static suite* head = nullptr;
+    return head;
+}
+
+void
+runner::
+add(
+    core::string_view name,
+    std::size_t iterations,
+    std::size_t bytes,
+    std::vector<double> v)
+{
+    std::sort(v.begin(), v.end());
+    result r;
+    r.name = std::string(name.data(), name.size());
+    r.iterations = iterations;
+    r.bytes = bytes;
+    r.ns_per_op = v.front();
+    r.ns_median = v[v.size() / 2];
+    std::fprintf(stderr, "%-40s %12.1f ns/op", r.name.c_str(), r.ns_per_op);
+    if(bytes != 0)
+        std::fprintf(stderr, " %10.1f MB/s",
+            bytes * 1000.0 / r.ns_per_op);
+    std::fprintf(stderr, "\n");
+    results_.push_back(std::move(r));
+}
+
+static
+void
+append_escaped(
+    std::string& s,
+    std::string const& v)
+{
+    for(char c : v)
+    {
+        if(c == '"' || c == '\\')
+            s.push_back('\\');
+        s.push_back(c);
+    }
+}
+
+std::string
+runner::
+to_json() const
+{
+    char buf[64];
+    std::string s = "{\n  \"benchmarks\": [";
+    bool first = true;
+    for(auto const& r : results_)
+    {
+        s += first ? "\n" : ",\n";
+        first = false;
+        s += "    { \"name\": \"";
+        append_escaped(s, r.name);
+        s += "\", \"iterations\": ";
+        s += std::to_string(r.iterations);
+        s += ", \"bytes_per_op\": ";
+        s += std::to_string(r.bytes);
+        std::snprintf(buf, sizeof(buf), "%.3f", r.ns_per_op);
+        s += ", \"ns_per_op\": ";
+        s += buf;
+        std::snprintf(buf, sizeof(buf), "%.3f", r.ns_median);
+        s += ", \"ns_median\": ";
+        s += buf;
+        s += " }";
+    }
+    s += "\n  ]\n}\n";
+    return s;
+}
+
+} // bench
+} // buffers
+} // boost
+
+//------------------------------------------------
+
+// usage: boost_buffers_bench [--filter=<substring>]
+//            [--min-time-ms=<ms>] [--out=<file>]
+int
+main(int argc, char** argv)
+{
+    using namespace boost::buffers::bench;
+
+    std::string filter;
+    std::string out;
+    long min_time_ms = 20;
+    for(int i = 1; i < argc; ++i)
+    {
+        char const* arg = argv[i];
+        if(std::strncmp(arg, "--filter=", 9) == 0)
+            filter = arg + 9;
+        else if(std::strncmp(arg, "--out=", 6) == 0)
+            out = arg + 6;
+        else if(std::strncmp(arg, "--min-time-ms=", 14) == 0)
+            min_time_ms = std::strtol(arg + 14, nullptr, 10);
+        else
+        {
+            std::cerr <<
+                "usage: " << argv[0] <<
+                " [--filter=<substring>]"
+                " [--min-time-ms=<ms>]"
+                " [--out=<file>]\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // run suites in registration order
+    std::vector<suite*> v;
+    for(auto p = suites(); p; p = p->next())
+        v.push_back(p);
+    std::reverse(v.begin(), v.end());
+
+    runner r(filter, std::chrono::milliseconds(min_time_ms));
+    for(auto p : v)
+        p->run(r);
+
+    auto const json = r.to_json();
+    if(out.empty())
+    {
+        std::cout << json;
+        return EXIT_SUCCESS;
+    }
+    std::ofstream f(out);
+    if(! f)
+    {
+        std::cerr << "unable to open " << out << "\n";
+        return EXIT_FAILURE;
+    }
+    f << json;
+    return EXIT_SUCCESS;
+}
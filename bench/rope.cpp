@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/rope.hpp>
+
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+// Split a sequence at a byte offset in the middle
+// and join the halves back together. With a vector
+// this is linear in the number of segments, with a
+// rope it is logarithmic.
+struct rope_bench
+{
+    static constexpr std::size_t segment = 64;
+
+    void
+    run(runner& r)
+    {
+        for(std::size_t n : { 16, 256, 4096, 65536 })
+        {
+            std::string s(n * segment, 'x');
+            auto const mid = s.size() / 2;
+            auto const suffix = "/" + std::to_string(n);
+
+            std::vector<const_buffer> v;
+            for(std::size_t i = 0; i < n; ++i)
+                v.emplace_back(&s[i * segment], segment);
+            r.measure("rope/vector" + suffix, 0, [&]
+            {
+                std::size_t i = 0;
+                std::size_t pos = 0;
+                while(pos < mid)
+                    pos += v[i++].size();
+                std::vector<const_buffer> rest(
+                    v.begin() + i, v.end());
+                v.erase(v.begin() + i, v.end());
+                do_not_optimize(rest);
+                v.insert(v.end(), rest.begin(), rest.end());
+            });
+
+            rope rp;
+            for(std::size_t i = 0; i < n; ++i)
+                rp.append(const_buffer(&s[i * segment], segment));
+            r.measure("rope/rope" + suffix, 0, [&]
+            {
+                auto rest = rp.split(mid);
+                do_not_optimize(rest);
+                rp.append(std::move(rest));
+            });
+        }
+    }
+};
+
+BENCH_SUITE(rope_bench, "rope");
+
+} // bench
+} // buffers
+} // boost
@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/slice.hpp>
+
+#include <list>
+#include <string>
+
+#include "bench.hpp"
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+namespace {
+
+// A non-owning bidirectional view of a list, so
+// that copying the sequence into the slice does
+// not depend on the number of segments.
+class list_view
+{
+    std::list<const_buffer> const* v_ = nullptr;
+
+public:
+    using const_iterator =
+        std::list<const_buffer>::const_iterator;
+
+    list_view() = default;
+
+    explicit
+    list_view(
+        std::list<const_buffer> const& v) noexcept
+        : v_(&v)
+    {
+    }
+
+    const_iterator
+    begin() const noexcept
+    {
+        return v_->begin();
+    }
+
+    const_iterator
+    end() const noexcept
+    {
+        return v_->end();
+    }
+};
+
+} // (anon)
+
+// Peel a small header off sequences of increasing
+// length. The time per operation should not grow
+// with the number of segments.
+struct slice_bench
+{
+    static constexpr std::size_t segment = 64;
+    static constexpr std::size_t header = 100;
+
+    void
+    run(runner& r)
+    {
+        for(std::size_t n : { 16, 256, 4096, 65536 })
+        {
+            std::string s(n * segment, 'x');
+            std::list<const_buffer> l;
+            for(std::size_t i = 0; i < n; ++i)
+                l.emplace_back(&s[i * segment], segment);
+            list_view const bs(l);
+            auto const suffix = "/" + std::to_string(n);
+
+            r.measure("slice/prefix" + suffix, 0, [&]
+            {
+                do_not_optimize(prefix(bs, header));
+            });
+
+            r.measure("slice/sans_prefix" + suffix, 0, [&]
+            {
+                do_not_optimize(sans_prefix(bs, header));
+            });
+
+            r.measure("slice/keep_prefix" + suffix, 0, [&]
+            {
+                slice_of<list_view> v(bs);
+                remove_prefix(v, header);
+                keep_prefix(v, header);
+                do_not_optimize(v);
+            });
+        }
+    }
+};
+
+BENCH_SUITE(slice_bench, "slice");
+
+} // bench
+} // buffers
+} // boost
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/string_buffer.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "bench.hpp"
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+namespace {
+
+// Character traits which count the characters
+// written by the string itself
+struct counting_traits
+    : std::char_traits<char>
+{
+    static std::size_t written;
+
+    using std::char_traits<char>::assign;
+
+    static
+    char*
+    assign(char* p, std::size_t n, char c)
+    {
+        written += n;
+        return std::char_traits<char>::assign(p, n, c);
+    }
+
+    static
+    char*
+    copy(char* dest, char const* src, std::size_t n)
+    {
+        written += n;
+        return std::char_traits<char>::copy(dest, src, n);
+    }
+
+    static
+    char*
+    move(char* dest, char const* src, std::size_t n)
+    {
+        written += n;
+        return std::char_traits<char>::move(dest, src, n);
+    }
+};
+
+std::size_t counting_traits::written = 0;
+
+using counting_string = std::basic_string<
+    char, counting_traits>;
+
+} // (anon)
+
+struct string_buffer_bench
+{
+    static constexpr std::size_t body = 1024 * 1024;
+    static constexpr std::size_t chunk = 4096;
+
+    // Drain a large body in small pieces
+    void
+    consume(runner& r)
+    {
+        std::string const src(body, 'x');
+        std::string s;
+        r.measure("string_buffer/consume_4k", body, [&]
+        {
+            s = src;
+            string_buffer b(&s);
+            while(b.size() > 0)
+                b.consume(chunk);
+            do_not_optimize(s);
+        });
+    }
+
+    // Receive a body in chunks. Prints the characters
+    // written per received byte, including the received
+    // bytes themselves.
+    //
+    // reserve: storage reserved up front
+    // keep:    bytes left after draining each chunk,
+    //          or std::size_t(-1) to keep everything
+    void
+    receive(
+        runner& r,
+        std::string const& name,
+        std::size_t reserve,
+        std::size_t keep)
+    {
+        if(! r.enabled(name))
+            return;
+        std::string const src(chunk, 'x');
+        std::size_t written = 0;
+        r.measure(name, body, [&]
+        {
+            counting_string s;
+            s.reserve(reserve);
+            counting_traits::written = 0;
+            {
+                basic_string_buffer<char, counting_traits> b(&s);
+                for(std::size_t n = 0; n < body; n += chunk)
+                {
+                    auto const dest = b.prepare(chunk);
+                    std::memcpy(dest.data(), src.data(), chunk);
+                    b.commit(chunk);
+                    if(b.size() > keep)
+                        b.consume(b.size() - keep);
+                }
+            }
+            written = counting_traits::written + body;
+            do_not_optimize(s);
+        });
+        std::fprintf(stderr, "%-40s %12.3f written/byte\n",
+            name.c_str(), static_cast<double>(written) / body);
+    }
+
+    void
+    run(runner& r)
+    {
+        consume(r);
+        receive(r, "string_buffer/receive_body",
+            0, std::size_t(-1));
+        receive(r, "string_buffer/receive_body_reserved",
+            body, std::size_t(-1));
+        receive(r, "string_buffer/receive_stream",
+            0, 100);
+    }
+};
+
+BENCH_SUITE(string_buffer_bench, "string_buffer");
+
+} // bench
+} // buffers
+} // boost
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/uring_read_source.hpp>
+#include <boost/buffers/file_read_source.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "bench.hpp"
+
+namespace boost {
+namespace buffers {
+namespace bench {
+
+// Read a local file from start to end through
+// a caller's buffer, with a blocking source making
+// one preadv per buffer, and with io_uring keeping
+// several reads in flight. The warm runs find the
+// file in the page cache, so they measure the cost
+// of the system calls and copies. The cold runs
+// drop the file from the page cache before every
+// pass, so they measure how well the reads keep
+// the device busy.
+struct uring_read_source_bench
+{
+    static constexpr std::size_t file_size = 64 * 1024 * 1024;
+
+    // Remove the file's pages from the page cache
+    static
+    void
+    drop_cache(char const* path)
+    {
+        int const fd = ::open(path, O_RDONLY);
+        if(fd == -1)
+            return;
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+
+    template<class Source>
+    static
+    void
+    read_file(
+        Source& src,
+        std::vector<char>& buf)
+    {
+        src.rewind();
+        system::error_code ec;
+        std::size_t total = 0;
+        do
+        {
+            total += src.read(mutable_buffer(
+                buf.data(), buf.size()), ec);
+            do_not_optimize(buf[0]);
+        }
+        while(! ec.failed());
+        do_not_optimize(total);
+    }
+
+    template<class Source>
+    static
+    void
+    measure(
+        runner& r,
+        std::string const& name,
+        char const* path,
+        bool cold,
+        Source& src,
+        std::vector<char>& buf)
+    {
+        r.measure(name, file_size, [&]
+        {
+            if(cold)
+                drop_cache(path);
+            read_file(src, buf);
+        });
+    }
+
+    void
+    run(runner& r)
+    {
+        char name[] = "/tmp/boost_buffers_bench_XXXXXX";
+        int const fd = ::mkstemp(name);
+        if(fd == -1)
+            return;
+        {
+            std::string block(1024 * 1024, 'x');
+            for(std::size_t n = 0; n < file_size; n += block.size())
+                if(::write(fd, block.data(), block.size()) !=
+                        static_cast<ssize_t>(block.size()))
+                    break;
+
+            // dirty pages are not dropped
+            ::fdatasync(fd);
+            ::close(fd);
+        }
+
+        for(bool cold : { false, true })
+        for(std::size_t size : { 4 * 1024, 64 * 1024, 1024 * 1024 })
+        {
+            std::vector<char> buf(size);
+            std::string const prefix =
+                std::string("uring_read_source/") +
+                (cold ? "cold/" : "warm/") +
+                std::to_string(size / 1024) + "k/";
+            {
+                file_read_source src(name);
+                measure(r, prefix + "preadv",
+                    name, cold, src, buf);
+            }
+            {
+                uring_read_source::options opt;
+                opt.use_uring = false;
+                uring_read_source src(name, opt);
+                measure(r, prefix + "fallback",
+                    name, cold, src, buf);
+            }
+            for(std::size_t depth : { 1, 2, 4, 8 })
+            {
+                uring_read_source::options opt;
+                opt.queue_depth = depth;
+                uring_read_source src(name, opt);
+                if(! src.is_uring())
+                    break;
+                measure(r, prefix + "uring/" +
+                    std::to_string(depth), name, cold, src, buf);
+            }
+        }
+        ::unlink(name);
+    }
+};
+
+BENCH_SUITE(uring_read_source_bench, "uring_read_source");
+
+} // bench
+} // buffers
+} // boost
+
+#endif
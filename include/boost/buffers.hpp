@@ -10,16 +10,28 @@
 #ifndef BOOST_BUFFERS_HPP
 #define BOOST_BUFFERS_HPP
 
+#include <boost/buffers/aligned_buffer.hpp>
+#include <boost/buffers/block_pool.hpp>
 #include <boost/buffers/buffer.hpp>
 #include <boost/buffers/buffer_pair.hpp>
 #include <boost/buffers/circular_buffer.hpp>
 #include <boost/buffers/copy.hpp>
 #include <boost/buffers/dynamic_buffer.hpp>
+#include <boost/buffers/file_read_source.hpp>
 #include <boost/buffers/flat_buffer.hpp>
 #include <boost/buffers/front.hpp>
+#include <boost/buffers/growable_flat_buffer.hpp>
+#include <boost/buffers/iovec.hpp>
 #include <boost/buffers/make_buffer.hpp>
+#include <boost/buffers/mapped_file_source.hpp>
+#include <boost/buffers/mirrored_buffer.hpp>
+#include <boost/buffers/pow2_circular_buffer.hpp>
 #include <boost/buffers/range.hpp>
+#include <boost/buffers/rope.hpp>
+#include <boost/buffers/segmented_buffer.hpp>
+#include <boost/buffers/shared_buffer.hpp>
 #include <boost/buffers/slice.hpp>
 #include <boost/buffers/string_buffer.hpp>
+#include <boost/buffers/uring_read_source.hpp>
 
 #endif
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_ALIGNED_BUFFER_HPP
+#define BOOST_BUFFERS_ALIGNED_BUFFER_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/buffer.hpp>
+#include <boost/buffers/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <new>
+
+namespace boost {
+namespace buffers {
+
+/** An owned block of memory with a specified alignment.
+
+    The address and the size of the memory are
+    both multiples of the alignment. This meets the
+    requirements of unbuffered file I/O, such as the
+    direct mode of @ref file_read_source, where the
+    buffers, their sizes and the file offsets must
+    be aligned to the logical block size of the
+    device.
+
+    Objects are convertible to @ref mutable_buffer,
+    and satisfy the requirements of
+    MutableBufferSequence. Objects are move-only.
+*/
+class aligned_buffer
+{
+    void* raw_ = nullptr;
+    mutable_buffer mb_;
+
+public:
+    /** The default alignment.
+
+        This is a multiple of the logical block
+        size of common storage devices, and of the
+        page size on most systems.
+    */
+    static constexpr std::size_t default_alignment = 4096;
+
+    /** Destructor.
+    */
+    ~aligned_buffer()
+    {
+        ::operator delete(raw_);
+    }
+
+    /** Constructor.
+
+        Default-constructed objects are empty.
+    */
+    aligned_buffer() = default;
+
+    /** Constructor.
+
+        The contents of the memory are unspecified.
+
+        @param size The number of bytes. This is
+        rounded up to a multiple of `alignment`.
+
+        @param alignment The alignment, which must
+        be a power of two.
+
+        @throw std::length_error if the size is
+        too large.
+    */
+    explicit
+    aligned_buffer(
+        std::size_t size,
+        std::size_t alignment = default_alignment)
+    {
+        BOOST_ASSERT(alignment != 0);
+        BOOST_ASSERT((alignment & (alignment - 1)) == 0);
+        if(size > std::size_t(-1) - 2 * alignment)
+            detail::throw_length_error();
+        size = (size + alignment - 1) & ~(alignment - 1);
+        if(size == 0)
+            return;
+        raw_ = ::operator new(size + alignment - 1);
+        auto const p =
+            (reinterpret_cast<std::uintptr_t>(raw_) +
+                alignment - 1) & ~(alignment - 1);
+        mb_ = mutable_buffer(
+            reinterpret_cast<void*>(p), size);
+    }
+
+    /** Constructor.
+
+        The new object takes ownership of the memory,
+        and `other` is left empty.
+    */
+    aligned_buffer(
+        aligned_buffer&& other) noexcept
+        : raw_(other.raw_)
+        , mb_(other.mb_)
+    {
+        other.raw_ = nullptr;
+        other.mb_ = {};
+    }
+
+    /** Assignment.
+
+        The memory of `*this` is released, and
+        `other` is left empty.
+    */
+    aligned_buffer&
+    operator=(
+        aligned_buffer&& other) noexcept
+    {
+        if(this != &other)
+        {
+            ::operator delete(raw_);
+            raw_ = other.raw_;
+            mb_ = other.mb_;
+            other.raw_ = nullptr;
+            other.mb_ = {};
+        }
+        return *this;
+    }
+
+    aligned_buffer(
+        aligned_buffer const&) = delete;
+
+    aligned_buffer& operator=(
+        aligned_buffer const&) = delete;
+
+    /** Return a pointer to the memory.
+    */
+    void*
+    data() const noexcept
+    {
+        return mb_.data();
+    }
+
+    /** Return the number of bytes.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return mb_.size();
+    }
+
+    /** Return the memory as a buffer.
+    */
+    operator mutable_buffer() const noexcept
+    {
+        return mb_;
+    }
+};
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,368 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_ANY_ASYNC_READ_SOURCE_HPP
+#define BOOST_BUFFERS_ANY_ASYNC_READ_SOURCE_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/async_read_source.hpp>
+
+#ifdef BOOST_BUFFERS_HAS_COROUTINES
+
+#include <boost/buffers/any_read_source.hpp>
+#include <boost/buffers/detail/except.hpp>
+#include <boost/buffers/error.hpp>
+#include <boost/core/span.hpp>
+#include <coroutine>
+#include <optional>
+#include <type_traits>
+
+namespace boost {
+namespace buffers {
+
+namespace detail {
+
+// Converts to the result of calling f, which
+// lets emplace construct a type which is not
+// movable from a function returning it
+template<class F>
+struct elide
+{
+    F f;
+
+    operator std::invoke_result_t<F&>()
+    {
+        return f();
+    }
+};
+
+template<class F>
+elide(F) -> elide<F>;
+
+} // detail
+
+/** Type-erased interface to an asynchronous read source
+
+    The operation started by @ref read, and the
+    awaitable returned by the erased source, are
+    stored in the type-erased object, so that no
+    memory is allocated for each read. As a
+    consequence only one operation may be
+    outstanding at a time.
+
+    When the elements of the buffer sequence are
+    contiguous in memory, the whole sequence is passed
+    to the source. Otherwise up to
+    @ref BOOST_BUFFERS_ANY_READ_SOURCE_BATCH buffers
+    are copied into the awaitable and passed to the
+    source, which is permitted because an asynchronous
+    read may fill only part of the buffers.
+
+    @see
+        @ref is_async_read_source,
+        @ref make_any_async_read_source.
+*/
+class BOOST_SYMBOL_VISIBLE
+    any_async_read_source
+{
+public:
+    /** The awaitable returned by @ref read.
+    */
+    class awaitable
+    {
+        static constexpr std::size_t N =
+            BOOST_BUFFERS_ANY_READ_SOURCE_BATCH;
+
+        any_async_read_source* s_;
+        system::error_code* ec_;
+        mutable_buffer const* p_ = nullptr;
+        std::size_t n_ = 0;
+        mutable_buffer mb_[N];
+
+        friend class any_async_read_source;
+
+        awaitable(
+            any_async_read_source& s,
+            system::error_code& ec) noexcept
+            : s_(&s)
+            , ec_(&ec)
+        {
+        }
+
+    public:
+        bool
+        await_ready()
+        {
+            if(! p_)
+                p_ = mb_;
+            s_->do_start(p_, n_, *ec_);
+            return s_->do_await_ready();
+        }
+
+        std::coroutine_handle<>
+        await_suspend(
+            std::coroutine_handle<> h)
+        {
+            return s_->do_await_suspend(h);
+        }
+
+        std::size_t
+        await_resume()
+        {
+            return s_->do_await_resume();
+        }
+    };
+
+    virtual ~any_async_read_source() = default;
+
+    virtual bool has_size() const noexcept = 0;
+
+    virtual bool has_rewind() const noexcept = 0;
+
+    virtual std::uint64_t size() const = 0;
+
+    virtual void rewind() = 0;
+
+    /** Read into a buffer sequence.
+
+        The returned awaitable refers to `dest` and
+        `ec`, which must remain valid until it is
+        awaited, and it must be awaited at most once.
+    */
+    template<class MutableBufferSequence>
+    awaitable
+    read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        awaitable a(*this, ec);
+        assign(a, dest, detail::is_contiguous_mutable_buffers<
+            MutableBufferSequence>{});
+        return a;
+    }
+
+private:
+    template<class MutableBufferSequence>
+    static
+    void
+    assign(
+        awaitable& a,
+        MutableBufferSequence const& dest,
+        std::true_type) noexcept
+    {
+        auto const sp = detail::contiguous_span(dest);
+        a.p_ = sp.data();
+        a.n_ = sp.size();
+    }
+
+    template<class MutableBufferSequence>
+    static
+    void
+    assign(
+        awaitable& a,
+        MutableBufferSequence const& dest,
+        std::false_type) noexcept
+    {
+        auto it = buffers::begin(dest);
+        auto const end_ = buffers::end(dest);
+        while(it != end_ && a.n_ < awaitable::N)
+            a.mb_[a.n_++] = *it++;
+    }
+
+    virtual void do_start(
+        mutable_buffer const* p,
+        std::size_t n,
+        system::error_code& ec) = 0;
+
+    virtual bool do_await_ready() = 0;
+
+    virtual std::coroutine_handle<> do_await_suspend(
+        std::coroutine_handle<> h) = 0;
+
+    virtual std::size_t do_await_resume() = 0;
+};
+
+//-----------------------------------------------
+
+namespace detail {
+
+template<class Source>
+class async_read_source_impl
+    : public any_async_read_source
+{
+    using awaitable_type = decltype(
+        std::declval<Source&>().read(
+            std::declval<span<mutable_buffer const> const&>(),
+            std::declval<system::error_code&>()));
+
+    using awaiter_type = awaiter_t<awaitable_type>;
+
+    static constexpr bool has_co_await =
+        has_member_co_await<awaitable_type>::value;
+
+public:
+    template<class Source_>
+    explicit async_read_source_impl(
+        Source_&& source) noexcept
+        : source_(std::forward<Source_>(source))
+    {
+    }
+
+private:
+    bool has_size() const noexcept override
+    {
+        return buffers::has_size<Source>::value;
+    }
+
+    bool has_rewind() const noexcept override
+    {
+        return buffers::has_rewind<Source>::value;
+    }
+
+    std::uint64_t size() const override
+    {
+        if constexpr(buffers::has_size<Source>::value)
+            return source_.size();
+        else
+            detail::throw_invalid_argument();
+    }
+
+    void rewind() override
+    {
+        if constexpr(buffers::has_rewind<Source>::value)
+        {
+            ec_ = {};
+            source_.rewind();
+        }
+        else
+        {
+            detail::throw_invalid_argument();
+        }
+    }
+
+    awaiter_type&
+    awaiter() noexcept
+    {
+        if constexpr(has_co_await)
+            return *w_;
+        else
+            return *a_;
+    }
+
+    void
+    do_start(
+        mutable_buffer const* p,
+        std::size_t n,
+        system::error_code& ec) override
+    {
+        BOOST_ASSERT(! a_);
+        ec_out_ = &ec;
+        if(ec_.failed())
+            return;
+        // the operation may refer to the
+        // sequence until it completes
+        dest_ = span<mutable_buffer const>(p, n);
+        a_.emplace(detail::elide{[&]{
+            return source_.read(dest_, ec); }});
+        if constexpr(has_co_await)
+            w_.emplace(detail::elide{[this]{
+                return std::move(*a_).operator co_await(); }});
+    }
+
+    bool
+    do_await_ready() override
+    {
+        if(! a_)
+            return true;
+        return awaiter().await_ready();
+    }
+
+    std::coroutine_handle<>
+    do_await_suspend(
+        std::coroutine_handle<> h) override
+    {
+        using R = decltype(awaiter().await_suspend(h));
+        if constexpr(std::is_void_v<R>)
+        {
+            awaiter().await_suspend(h);
+            return std::noop_coroutine();
+        }
+        else if constexpr(std::is_same_v<R, bool>)
+        {
+            if(awaiter().await_suspend(h))
+                return std::noop_coroutine();
+            return h;
+        }
+        else
+        {
+            return awaiter().await_suspend(h);
+        }
+    }
+
+    std::size_t
+    do_await_resume() override
+    {
+        if(! a_)
+        {
+            // a previous read failed
+            *ec_out_ = ec_;
+            return 0;
+        }
+        struct reset
+        {
+            async_read_source_impl* self;
+
+            ~reset()
+            {
+                self->w_.reset();
+                self->a_.reset();
+            }
+        };
+        reset r{ this };
+        std::size_t const n = awaiter().await_resume();
+        ec_ = *ec_out_;
+        return n;
+    }
+
+    Source source_;
+    system::error_code ec_;
+    system::error_code* ec_out_ = nullptr;
+    span<mutable_buffer const> dest_;
+    std::optional<awaitable_type> a_;
+    std::optional<typename std::conditional<
+        has_co_await, awaiter_type, char>::type> w_;
+};
+
+} // detail
+
+//-----------------------------------------------
+
+/** Return a type-erased asynchronous read source.
+
+    @param source The source to erase, which
+    is moved or copied into the result.
+*/
+template<class AsyncReadSource>
+auto
+make_any_async_read_source(
+    AsyncReadSource&& source) ->
+        detail::async_read_source_impl<typename
+            std::decay<AsyncReadSource>::type>
+{
+    return detail::async_read_source_impl<typename
+        std::decay<AsyncReadSource>::type>(
+            std::forward<AsyncReadSource>(source));
+}
+
+} // buffers
+} // boost
+
+#endif
+
+#endif
@@ -16,6 +16,7 @@
 #include <boost/assert.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <new>
 #include <type_traits>
 
@@ -27,12 +28,15 @@ namespace buffers {
     This class template wraps any buffer sequence and
     exposes it through a uniform interface, hiding the
     concrete type. Iteration is performed via a type-erased
-    bidirectional iterator.
+    bidirectional iterator, or a random access iterator when
+    `IsRandomAccess` is `true`. Every operation of the
+    iterator takes constant time.
 
     The implementation uses small buffer optimization (SBO)
     for iterators that are small, trivially aligned, and
-    nothrow copy constructible. Larger iterators fall back
-    to an index-based traversal strategy.
+    nothrow copy constructible. Larger iterators are held
+    in dynamically allocated storage, so that every
+    iterator operation remains constant time.
 
     @note The wrapped buffer sequence must remain valid
     for the lifetime of this object.
@@ -41,9 +45,14 @@ namespace buffers {
     @ref const_buffer elements. If `false`, it yields
     @ref mutable_buffer elements.
 
+    @tparam IsRandomAccess If `true`, iterators are random
+    access, and only sequences whose iterators are random
+    access may be wrapped. If `false`, iterators are
+    bidirectional, and any sequence may be wrapped.
+
     @see any_const_buffers, any_mutable_buffers, make_any_buffers
 */
-template<bool IsConst>
+template<bool IsConst, bool IsRandomAccess = false>
 class any_buffers
 {
 public:
@@ -55,7 +64,10 @@ public:
     using value_type = typename std::conditional<
         IsConst, const_buffer, mutable_buffer>::type;
 
-    /** A bidirectional iterator over the buffer sequence.
+    /** An iterator over the buffer sequence.
+
+        This is random access when `IsRandomAccess`
+        is `true`, otherwise bidirectional.
 
         @see begin, end
     */
@@ -65,14 +77,20 @@ public:
 
         @return An iterator pointing to the first buffer,
         or `end()` if the sequence is empty.
+
+        @throws std::bad_alloc if the wrapped iterator
+        does not fit in the small buffer and allocation fails.
     */
-    const_iterator begin() const noexcept;
+    const_iterator begin() const;
 
     /** Return an iterator to the end.
 
         @return An iterator pointing one past the last buffer.
+
+        @throws std::bad_alloc if the wrapped iterator
+        does not fit in the small buffer and allocation fails.
     */
-    const_iterator end() const noexcept;
+    const_iterator end() const;
 
     /** Construct from a buffer sequence.
 
@@ -82,18 +100,73 @@ public:
 
         @param bs The buffer sequence to wrap. Must satisfy
         `ConstBufferSequence`. If `IsConst` is `false`, must
-        also satisfy `MutableBufferSequence`.
+        also satisfy `MutableBufferSequence`. If
+        `IsRandomAccess` is `true`, its iterators must be
+        random access.
 
         @tparam BufferSequence The concrete buffer sequence type.
     */
     template<class BufferSequence>
     any_buffers(BufferSequence const& bs);
 
+    /** Copy consecutive buffers into an array.
+
+        Up to `n` buffers starting at `pos` are stored
+        in `dest`, and `pos` is advanced past them. This
+        costs a single indirect call regardless of `n`,
+        so algorithms which visit every buffer can do so
+        in batches:
+
+        @code
+        any_const_buffers::const_iterator it = bs.begin();
+        const_buffer v[16];
+        while(std::size_t n = bs.fetch(it, v, 16))
+            consume(v, n);
+        @endcode
+
+        @return The number of buffers stored. This is
+        less than `n` only when the end of the sequence
+        is reached.
+
+        @param pos The position to start from. Upon
+        return, it refers to the first buffer which
+        was not stored.
+
+        @param dest A pointer to at least `n` elements.
+
+        @param n The maximum number of buffers to store.
+
+        @throws Any exception thrown by the wrapped
+        iterator or by the wrapped sequence's `end`.
+    */
+    std::size_t
+    fetch(
+        const_iterator& pos,
+        value_type* dest,
+        std::size_t n) const;
+
+    /** Return the total number of bytes in the sequence.
+
+        The wrapped sequence is measured directly, so
+        no iterator is copied to dynamic storage.
+    */
+    friend
+    std::size_t
+    tag_invoke(
+        size_tag const&,
+        any_buffers const& bs) noexcept
+    {
+        return bs.ops_->size(bs.bs_);
+    }
+
 private:
     static constexpr std::size_t sbo_size = 4 * sizeof(void*);
 
     struct iter_ops;
 
+    template<class Iter> struct small_storage;
+    template<class Iter> struct heap_storage;
+
     template<class Buffers>
     static iter_ops const* make_ops()
     {
@@ -103,43 +176,54 @@ private:
             sizeof(iter_t) <= sbo_size &&
             alignof(iter_t) <= alignof(std::max_align_t) &&
             std::is_nothrow_copy_constructible<iter_t>::value;
-        return make_ops<Buffers>(
-            std::integral_constant<bool, is_small>{});
+        return make_ops<Buffers, typename std::conditional<
+            is_small,
+            small_storage<iter_t>,
+            heap_storage<iter_t>>::type>();
     }
 
-    template<class Buffers>
-    static iter_ops const* make_ops(std::true_type);
+    template<class Buffers, class Storage>
+    static iter_ops const* make_ops();
 
-    template<class Buffers>
-    static iter_ops const* make_ops(std::false_type);
+    using advance_fn = void (*)(void*, std::ptrdiff_t);
+    using distance_fn = std::ptrdiff_t (*)(void const*, void const*);
 
-    template<class Buffers>
-    std::size_t get_length(Buffers const& bs)
+    // jumps exist only for random access
+    template<class Storage>
+    static advance_fn make_advance(std::true_type) noexcept
     {
-        using iter_t = decltype(buffers::begin(
-            std::declval<Buffers const&>()));
-        static constexpr bool is_small =
-            sizeof(iter_t) <= sbo_size &&
-            alignof(iter_t) <= alignof(std::max_align_t) &&
-            std::is_nothrow_copy_constructible<iter_t>::value;
-        return get_length(bs, std::integral_constant<bool, is_small>{});
+        return [](void* p, std::ptrdiff_t n)
+        {
+            auto& it = Storage::get(p);
+            it += static_cast<typename std::iterator_traits<
+                typename std::decay<decltype(it)>::type>::
+                    difference_type>(n);
+        };
     }
 
-    template<class Buffers>
-    std::size_t get_length(Buffers const&, std::true_type)
+    template<class Storage>
+    static advance_fn make_advance(std::false_type) noexcept
     {
-        // no-op since length is not needed
-        return 0;
+        return nullptr;
     }
 
-    template<class Buffers>
-    std::size_t get_length(Buffers const& bs, std::false_type)
+    template<class Storage>
+    static distance_fn make_distance(std::true_type) noexcept
+    {
+        return [](void const* a, void const* b) -> std::ptrdiff_t
+        {
+            return static_cast<std::ptrdiff_t>(
+                Storage::get(b) - Storage::get(a));
+        };
+    }
+
+    template<class Storage>
+    static distance_fn make_distance(std::false_type) noexcept
     {
-        return buffers::length(bs);
+        return nullptr;
     }
 
     void const* bs_ = nullptr;
-    std::size_t len_ = 0;
     iter_ops const* ops_ = nullptr;
 };
 
@@ -161,8 +245,8 @@ using any_mutable_buffers = any_buffers<false>;
 
 //-----------------------------------------------
 
-template<bool IsConst>
-struct any_buffers<IsConst>::
+template<bool IsConst, bool IsRandomAccess>
+struct any_buffers<IsConst, IsRandomAccess>::
     iter_ops
 {
     void (*copy)(void*, void const*);
@@ -171,21 +255,28 @@ struct any_buffers<IsConst>::
     void (*decrement)(void*);
     value_type (*deref)(void const*);
     bool (*equal)(void const*, void const*);
+    advance_fn advance;     // null unless IsRandomAccess
+    distance_fn distance;   // null unless IsRandomAccess
+    std::size_t (*fetch)(void*, void const*, value_type*, std::size_t);
+    std::size_t (*size)(void const*);
     void (*construct_begin)(void*, void const*);
-    void (*construct_end)(void*, void const*, std::size_t);
+    void (*construct_end)(void*, void const*);
 };
 
 //-----------------------------------------------
 
-/** A bidirectional iterator for @ref any_buffers.
+/** An iterator for @ref any_buffers.
 
     This iterator provides type-erased access to the
-    underlying buffer sequence elements. It models
-    `BidirectionalIterator` and returns buffer objects
-    by value.
+    underlying buffer sequence elements, and returns
+    buffer objects by value. It models
+    `RandomAccessIterator` when `IsRandomAccess` is
+    `true`, and `BidirectionalIterator` otherwise, in
+    which case jumps, distances and ordering are not
+    provided.
 */
-template<bool IsConst>
-class any_buffers<IsConst>::
+template<bool IsConst, bool IsRandomAccess>
+class any_buffers<IsConst, IsRandomAccess>::
     const_iterator
 {
 public:
@@ -209,13 +300,15 @@ public:
 
     /** Iterator category tag.
     */
-    using iterator_category =
-        std::bidirectional_iterator_tag;
+    using iterator_category = typename std::conditional<
+        IsRandomAccess,
+        std::random_access_iterator_tag,
+        std::bidirectional_iterator_tag>::type;
 
 #if defined(__cpp_concepts) || defined(__cpp_lib_concepts)
     /** Iterator concept tag (C++20).
     */
-    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_concept = iterator_category;
 #endif
 
     /** Destructor.
@@ -224,7 +317,8 @@ public:
     */
     ~const_iterator()
     {
-        ops_->destroy(&storage_);
+        if(ops_)
+            ops_->destroy(&storage_);
     }
 
     /** Default constructor.
@@ -237,28 +331,40 @@ public:
     /** Copy constructor.
 
         @param other The iterator to copy.
+
+        @throws std::bad_alloc if the wrapped iterator is
+        held in dynamically allocated storage and allocation fails.
     */
     const_iterator(
-        const_iterator const& other) noexcept
-        : ops_(other.ops_)
+        const_iterator const& other)
+        : bs_(other.bs_)
     {
-        ops_->copy(&storage_, &other.storage_);
+        if(other.ops_)
+            other.ops_->copy(&storage_, &other.storage_);
+        ops_ = other.ops_;
     }
 
     /** Copy assignment.
 
         @param other The iterator to copy.
         @return `*this`
+
+        @throws std::bad_alloc if the wrapped iterator is
+        held in dynamically allocated storage and allocation fails.
+        In this case `*this` becomes singular.
     */
     const_iterator& operator=(
-        const_iterator const& other) noexcept
+        const_iterator const& other)
     {
         if(this != &other)
         {
-            ops_->destroy(&storage_);
-
+            if(ops_)
+                ops_->destroy(&storage_);
+            ops_ = nullptr;
+            if(other.ops_)
+                other.ops_->copy(&storage_, &other.storage_);
             ops_ = other.ops_;
-            ops_->copy(&storage_, &other.storage_);
+            bs_ = other.bs_;
         }
         return *this;
     }
@@ -332,7 +438,7 @@ public:
         @pre The iterator is incrementable.
     */
     const_iterator
-    operator++(int) noexcept
+    operator++(int)
     {
         auto temp = *this;
         ++(*this);
@@ -364,13 +470,147 @@ public:
         @pre The iterator is decrementable.
     */
     const_iterator
-    operator--(int) noexcept
+    operator--(int)
     {
         auto temp = *this;
         --(*this);
         return temp;
     }
 
+    /** Advance the iterator by `n` positions.
+
+        This is available when `IsRandomAccess` is `true`.
+
+        @return `*this`
+
+        @param n The signed number of positions to move.
+    */
+    template<bool B = IsRandomAccess>
+    typename std::enable_if<B, const_iterator&>::type
+    operator+=(difference_type n) noexcept
+    {
+        BOOST_ASSERT(ops_ != nullptr);
+        ops_->advance(&storage_, n);
+        return *this;
+    }
+
+    /** Move the iterator back by `n` positions.
+
+        This is available when `IsRandomAccess` is `true`.
+
+        @return `*this`
+
+        @param n The signed number of positions to move.
+    */
+    template<bool B = IsRandomAccess>
+    typename std::enable_if<B, const_iterator&>::type
+    operator-=(difference_type n) noexcept
+    {
+        return *this += -n;
+    }
+
+    /** Return an iterator advanced by `n` positions.
+    */
+    template<bool B = IsRandomAccess>
+    friend
+    typename std::enable_if<B, const_iterator>::type
+    operator+(
+        const_iterator it,
+        difference_type n)
+    {
+        it += n;
+        return it;
+    }
+
+    /** Return an iterator advanced by `n` positions.
+    */
+    template<bool B = IsRandomAccess>
+    friend
+    typename std::enable_if<B, const_iterator>::type
+    operator+(
+        difference_type n,
+        const_iterator it)
+    {
+        it += n;
+        return it;
+    }
+
+    /** Return an iterator moved back by `n` positions.
+    */
+    template<bool B = IsRandomAccess>
+    friend
+    typename std::enable_if<B, const_iterator>::type
+    operator-(
+        const_iterator it,
+        difference_type n)
+    {
+        it -= n;
+        return it;
+    }
+
+    /** Return the number of positions from `b` to `a`.
+
+        @pre Both iterators refer to the same sequence.
+    */
+    template<bool B = IsRandomAccess>
+    friend
+    typename std::enable_if<B, difference_type>::type
+    operator-(
+        const_iterator const& a,
+        const_iterator const& b) noexcept
+    {
+        BOOST_ASSERT(a.ops_ != nullptr);
+        BOOST_ASSERT(a.ops_ == b.ops_);
+        return a.ops_->distance(
+            &b.storage_, &a.storage_);
+    }
+
+    /** Return the buffer `n` positions away.
+    */
+    template<bool B = IsRandomAccess>
+    typename std::enable_if<B, reference>::type
+    operator[](difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+    /** Ordering comparisons.
+
+        These are available when `IsRandomAccess`
+        is `true`.
+
+        @pre Both iterators refer to the same sequence.
+    */
+    /** @{ */
+    template<bool B = IsRandomAccess>
+    typename std::enable_if<B, bool>::type
+    operator<(const_iterator const& other) const noexcept
+    {
+        return (*this - other) < 0;
+    }
+
+    template<bool B = IsRandomAccess>
+    typename std::enable_if<B, bool>::type
+    operator>(const_iterator const& other) const noexcept
+    {
+        return other < *this;
+    }
+
+    template<bool B = IsRandomAccess>
+    typename std::enable_if<B, bool>::type
+    operator<=(const_iterator const& other) const noexcept
+    {
+        return !(other < *this);
+    }
+
+    template<bool B = IsRandomAccess>
+    typename std::enable_if<B, bool>::type
+    operator>=(const_iterator const& other) const noexcept
+    {
+        return !(*this < other);
+    }
+    /** @} */
+
 private:
     friend class any_buffers;
 
@@ -379,24 +619,26 @@ private:
 
     const_iterator(begin_tag,
         iter_ops const* ops,
-        void const* bs) noexcept
-        : ops_(ops)
+        void const* bs)
+        : bs_(bs)
     {
-        ops_->construct_begin(&storage_, bs);
+        ops->construct_begin(&storage_, bs);
+        ops_ = ops;
     }
 
     const_iterator(end_tag,
         iter_ops const* ops,
-        void const* bs,
-        std::size_t len) noexcept
-        : ops_(ops)
+        void const* bs)
+        : bs_(bs)
     {
-        ops_->construct_end(&storage_, bs, len);
+        ops->construct_end(&storage_, bs);
+        ops_ = ops;
     }
 
     alignas(std::max_align_t)
         unsigned char mutable storage_[sbo_size] = {};
     any_buffers::iter_ops const* ops_ = nullptr;
+    void const* bs_ = nullptr;
 };
 
 //-----------------------------------------------
@@ -430,13 +672,17 @@ protected:
     elements. Defaults to `true` if `BufferSequence` is
     not a mutable buffer sequence.
 
+    @tparam IsRandomAccess If `true`, iterators are
+    random access. Defaults to `false`.
+
     @see any_buffers, make_any_buffers
 */
 template<class BufferSequence,
-    bool IsConst = ! is_mutable_buffer_sequence<BufferSequence>::value>
+    bool IsConst = ! is_mutable_buffer_sequence<BufferSequence>::value,
+    bool IsRandomAccess = false>
 class any_buffers_impl
     : private detail::holder<BufferSequence>
-    , public any_buffers<IsConst>
+    , public any_buffers<IsConst, IsRandomAccess>
 {
 public:
     /** Move constructor.
@@ -458,7 +704,7 @@ public:
         BufferSequence_&& bs) noexcept
         : detail::holder<BufferSequence>(
             std::forward<BufferSequence_>(bs))
-        , any_buffers<IsConst>(this->t_)
+        , any_buffers<IsConst, IsRandomAccess>(this->t_)
     {
     }
 };
@@ -491,145 +737,151 @@ make_any_buffers(
 
 //-----------------------------------------------
 
-template<bool IsConst>
+template<bool IsConst, bool IsRandomAccess>
 template<class BufferSequence>
-any_buffers<IsConst>::
+any_buffers<IsConst, IsRandomAccess>::
 any_buffers(
     BufferSequence const& bs)
     : bs_(&bs)
-    , len_(get_length(bs))
     , ops_(make_ops<BufferSequence>())
 {
     BOOST_CORE_STATIC_ASSERT(
         is_const_buffer_sequence<BufferSequence>::value);
     BOOST_CORE_STATIC_ASSERT(IsConst ||
         is_mutable_buffer_sequence<BufferSequence>::value);
+    BOOST_CORE_STATIC_ASSERT(! IsRandomAccess ||
+        std::is_base_of<std::random_access_iterator_tag,
+            typename std::iterator_traits<decltype(
+                buffers::begin(bs))>::iterator_category>::value);
 }
 
-// small iterators
-template<bool IsConst>
-template<class Buffers>
+// small iterators live in the storage
+template<bool IsConst, bool IsRandomAccess>
+template<class Iter>
+struct any_buffers<IsConst, IsRandomAccess>::
+    small_storage
+{
+    static Iter& get(void* p) noexcept
+    {
+        return *static_cast<Iter*>(p);
+    }
+
+    static Iter const& get(void const* p) noexcept
+    {
+        return *static_cast<Iter const*>(p);
+    }
+
+    static void construct(void* p, Iter const& it) noexcept
+    {
+        ::new(p) Iter(it);
+    }
+
+    static void destroy(void* p) noexcept
+    {
+        get(p).~Iter();
+    }
+};
+
+// large iterators are copied to the heap,
+// and the storage holds a pointer to them
+template<bool IsConst, bool IsRandomAccess>
+template<class Iter>
+struct any_buffers<IsConst, IsRandomAccess>::
+    heap_storage
+{
+    static Iter& get(void* p) noexcept
+    {
+        return **static_cast<Iter**>(p);
+    }
+
+    static Iter const& get(void const* p) noexcept
+    {
+        return **static_cast<Iter* const*>(p);
+    }
+
+    static void construct(void* p, Iter const& it)
+    {
+        ::new(p) Iter*(new Iter(it));
+    }
+
+    static void destroy(void* p) noexcept
+    {
+        delete *static_cast<Iter**>(p);
+    }
+};
+
+template<bool IsConst, bool IsRandomAccess>
+template<class Buffers, class Storage>
 auto
-any_buffers<IsConst>::
-make_ops(std::true_type) ->
+any_buffers<IsConst, IsRandomAccess>::
+make_ops() ->
     iter_ops const*
 {
-    using iter_t = decltype(buffers::begin(
-        std::declval<Buffers const&>()));
+    using is_random = std::integral_constant<
+        bool, IsRandomAccess>;
+
     static const iter_ops ops = {
         // copy
         [](void* dest, void const* src)
         {
-            ::new(dest) iter_t(*static_cast<iter_t const*>(src));
+            Storage::construct(dest, Storage::get(src));
         },
         // destroy
-        [](void* p)
-        {
-            static_cast<iter_t*>(p)->~iter_t();
-        },
+        &Storage::destroy,
         // increment
         [](void* p)
         {
-            ++(*static_cast<iter_t*>(p));
+            ++Storage::get(p);
         },
         // decrement
         [](void* p)
         {
-            --(*static_cast<iter_t*>(p));
+            --Storage::get(p);
         },
         // deref
         [](void const* p) -> value_type
         {
-            return *(*static_cast<iter_t const*>(p));
+            return *Storage::get(p);
         },
         // equal
         [](void const* a, void const* b) -> bool
         {
-            return  *static_cast<iter_t const*>(a) ==
-                    *static_cast<iter_t const*>(b);
-        },
-        // construct_begin
-        [](void* storage, void const* bs)
-        {
-            ::new(storage) iter_t(buffers::begin(
-                *static_cast<Buffers const*>(bs)));
-        },
-        // construct_end
-        [](void* storage, void const* bs, std::size_t)
-        {
-            ::new(storage) iter_t(buffers::end(
-                *static_cast<Buffers const*>(bs)));
-        }
-    };
-    return &ops;
-}
-
-// large iterators
-template<bool IsConst>
-template<class Buffers>
-auto
-any_buffers<IsConst>::
-make_ops(std::false_type) ->
-    iter_ops const*
-{
-    struct iter_t
-    {
-        std::size_t i_;
-        Buffers const* bs_;
-    };
-
-    BOOST_CORE_STATIC_ASSERT(sizeof(iter_t) <= sbo_size);
-
-    static const iter_ops ops = {
-        // copy
-        [](void* dest, void const* src)
-        {
-            ::new(dest) iter_t(*static_cast<iter_t const*>(src));
-        },
-        // destroy
-        [](void* p)
-        {
-            static_cast<iter_t*>(p)->~iter_t();
-        },
-        // increment
-        [](void* p)
-        {
-            ++static_cast<iter_t*>(p)->i_;
-        },
-        // decrement
-        [](void* p)
-        {
-            --static_cast<iter_t*>(p)->i_;
+            return  Storage::get(a) ==
+                    Storage::get(b);
         },
-        // deref
-        [](void const* p) -> value_type
+        // advance
+        make_advance<Storage>(is_random{}),
+        // distance
+        make_distance<Storage>(is_random{}),
+        // fetch
+        [](void* p, void const* bs,
+            value_type* dest, std::size_t n) -> std::size_t
         {
-            auto const& it_ = *static_cast<iter_t const*>(p);
-            auto it = buffers::begin(*it_.bs_);
-            for(auto i = it_.i_; i; --i)
-                ++it;
-            return *it;
+            auto& it = Storage::get(p);
+            auto const end = buffers::end(
+                *static_cast<Buffers const*>(bs));
+            std::size_t i = 0;
+            for(; i < n && it != end; ++i, ++it)
+                dest[i] = *it;
+            return i;
         },
-        // equal
-        [](void const* a, void const* b) -> bool
+        // size
+        [](void const* bs) -> std::size_t
         {
-            auto const& it0 = *static_cast<iter_t const*>(a);
-            auto const& it1 = *static_cast<iter_t const*>(b);
-            return
-                it0.i_  == it1.i_ &&
-                it0.bs_ == it1.bs_;   
+            return buffers::size(
+                *static_cast<Buffers const*>(bs));
         },
         // construct_begin
         [](void* storage, void const* bs)
         {
-            ::new(storage) iter_t{ 0,
-                static_cast<Buffers const*>(bs) };
+            Storage::construct(storage, buffers::begin(
+                *static_cast<Buffers const*>(bs)));
         },
         // construct_end
-        [](void* storage, void const* bs, std::size_t len)
+        [](void* storage, void const* bs)
         {
-            ::new(storage) iter_t{ len,
-                static_cast<Buffers const*>(bs) };
+            Storage::construct(storage, buffers::end(
+                *static_cast<Buffers const*>(bs)));
         }
     };
     return &ops;
@@ -637,10 +889,10 @@ make_ops(std::false_type) ->
 
 //-----------------------------------------------
 
-template<bool IsConst>
+template<bool IsConst, bool IsRandomAccess>
 auto
-any_buffers<IsConst>::
-begin() const noexcept ->
+any_buffers<IsConst, IsRandomAccess>::
+begin() const ->
     const_iterator
 {
     return const_iterator(
@@ -648,15 +900,28 @@ begin() const noexcept ->
         ops_, bs_);
 }
 
-template<bool IsConst>
+template<bool IsConst, bool IsRandomAccess>
 auto
-any_buffers<IsConst>::
-end() const noexcept ->
+any_buffers<IsConst, IsRandomAccess>::
+end() const ->
     const_iterator
 {
     return const_iterator(
         typename const_iterator::end_tag{},
-        ops_, bs_, len_);
+        ops_, bs_);
+}
+
+template<bool IsConst, bool IsRandomAccess>
+std::size_t
+any_buffers<IsConst, IsRandomAccess>::
+fetch(
+    const_iterator& pos,
+    value_type* dest,
+    std::size_t n) const
+{
+    BOOST_ASSERT(pos.ops_ == ops_);
+    BOOST_ASSERT(pos.bs_ == bs_);
+    return ops_->fetch(&pos.storage_, bs_, dest, n);
 }
 
 //-----------------------------------------------
@@ -16,9 +16,85 @@
 #include <boost/core/span.hpp>
 #include <boost/assert.hpp>
 
+/** The number of buffers passed to a type-erased read source at once.
+
+    When @ref any_read_source::read is called with
+    a sequence whose elements are not contiguous in
+    memory, the elements are copied onto the stack
+    in batches of this size, and the source is
+    called once per batch. Defining this to a larger
+    value reduces the number of calls, and of system
+    calls made by the source, for sequences with
+    many elements.
+*/
+#ifndef BOOST_BUFFERS_ANY_READ_SOURCE_BATCH
+#define BOOST_BUFFERS_ANY_READ_SOURCE_BATCH 16
+#endif
+
 namespace boost {
 namespace buffers {
 
+namespace detail {
+
+// True if P points to mutable_buffer itself. A
+// pointer to a derived type has a different stride.
+template<class P>
+struct is_mutable_buffer_pointer
+    : std::integral_constant<bool,
+        std::is_pointer<P>::value &&
+        std::is_same<typename std::remove_cv<
+            typename std::remove_pointer<P>::type>::type,
+                mutable_buffer>::value>
+{
+};
+
+// Sequences whose elements are an array of mutable_buffer
+template<class T, class = void>
+struct is_contiguous_mutable_buffers
+    : is_mutable_buffer_pointer<decltype(buffers::begin(
+        std::declval<T const&>()))>
+{
+};
+
+template<class T>
+struct is_contiguous_mutable_buffers<T, void_t<typename
+    std::enable_if<
+        is_mutable_buffer_pointer<
+            decltype(std::declval<T const&>().data())>::value &&
+        std::is_convertible<
+            decltype(std::declval<T const&>().size()),
+            std::size_t>::value>::type>>
+    : std::true_type
+{
+};
+
+// The elements of a contiguous sequence as a span
+
+template<class T>
+span<mutable_buffer const>
+contiguous_span(T const& t, std::true_type) noexcept
+{
+    return { buffers::begin(t), static_cast<std::size_t>(
+        buffers::end(t) - buffers::begin(t)) };
+}
+
+template<class T>
+span<mutable_buffer const>
+contiguous_span(T const& t, std::false_type) noexcept
+{
+    return { t.data(), t.size() };
+}
+
+template<class T>
+span<mutable_buffer const>
+contiguous_span(T const& t) noexcept
+{
+    return contiguous_span(t, is_mutable_buffer_pointer<
+        decltype(buffers::begin(t))>{});
+}
+
+} // detail
+
 /** Type-erased interface to a read source
 */
 class BOOST_SYMBOL_VISIBLE
@@ -35,12 +111,34 @@ public:
 
     virtual void rewind() = 0;
 
+    /** Read into a buffer sequence.
+
+        When the elements of the sequence are
+        contiguous in memory, such as for a span, an
+        array or a vector of @ref mutable_buffer, the
+        whole sequence is passed to the source in a
+        single call. Otherwise the elements are copied
+        in batches of @ref BOOST_BUFFERS_ANY_READ_SOURCE_BATCH
+        and the source is called once for each batch.
+    */
     template<class MutableBufferSequence>
     std::size_t read(
         MutableBufferSequence const& dest,
         system::error_code& ec);
 
 private:
+    template<class MutableBufferSequence>
+    std::size_t read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec,
+        std::true_type);
+
+    template<class MutableBufferSequence>
+    std::size_t read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec,
+        std::false_type);
+
     virtual std::size_t do_read(
         mutable_buffer const* p,
         std::size_t n,
@@ -55,9 +153,41 @@ any_read_source::
 read(
     MutableBufferSequence const& dest,
     system::error_code& ec)
+{
+    return read(dest, ec, detail::is_contiguous_mutable_buffers<
+        MutableBufferSequence>{});
+}
+
+template<class MutableBufferSequence>
+std::size_t
+any_read_source::
+read(
+    MutableBufferSequence const& dest,
+    system::error_code& ec,
+    std::true_type)
+{
+    auto const sp = detail::contiguous_span(dest);
+    if(sp.empty())
+        return 0;
+    auto const nread = do_read(
+        sp.data(), sp.size(), ec);
+    BOOST_ASSERT(
+        ec.failed() ||
+        nread == buffers::size(sp));
+    return nread;
+}
+
+template<class MutableBufferSequence>
+std::size_t
+any_read_source::
+read(
+    MutableBufferSequence const& dest,
+    system::error_code& ec,
+    std::false_type)
 {
     std::size_t result = 0;
-    constexpr std::size_t N = 16;
+    constexpr std::size_t N =
+        BOOST_BUFFERS_ANY_READ_SOURCE_BATCH;
     std::size_t n = 0;
     mutable_buffer mb[N];
     auto it = buffers::begin(dest);
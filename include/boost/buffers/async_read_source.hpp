@@ -0,0 +1,490 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_ASYNC_READ_SOURCE_HPP
+#define BOOST_BUFFERS_ASYNC_READ_SOURCE_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/read_source.hpp>
+
+#ifdef BOOST_BUFFERS_HAS_COROUTINES
+
+#include <boost/buffers/buffer.hpp>
+#include <boost/buffers/slice.hpp>
+#include <boost/system/error_code.hpp>
+#include <boost/assert.hpp>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace buffers {
+
+namespace detail {
+
+template<class A, class = void>
+struct has_member_co_await : std::false_type
+{
+};
+
+template<class A>
+struct has_member_co_await<A, void_t<decltype(
+    std::declval<A>().operator co_await())>>
+    : std::true_type
+{
+};
+
+// The awaiter obtained when awaiting an A
+template<class A, bool = has_member_co_await<A>::value>
+struct awaiter_of
+{
+    using type = A;
+};
+
+template<class A>
+struct awaiter_of<A, true>
+{
+    using type = std::remove_cvref_t<decltype(
+        std::declval<A>().operator co_await())>;
+};
+
+template<class A>
+using awaiter_t = typename awaiter_of<A>::type;
+
+template<class A, class = void>
+struct is_size_awaitable : std::false_type
+{
+};
+
+template<class A>
+struct is_size_awaitable<A, void_t<typename
+    std::enable_if<
+        std::is_convertible<
+            decltype(std::declval<awaiter_t<A>&>().await_resume()),
+            std::size_t>::value>::type>>
+    : std::true_type
+{
+};
+
+// Blocks the calling thread until an awaitable completes
+class sync_wait_task
+{
+public:
+    struct state
+    {
+        std::mutex m;
+        std::condition_variable cv;
+        bool done = false;
+        std::size_t result = 0;
+        std::exception_ptr ep;
+    };
+
+    struct promise_type
+    {
+        state* st = nullptr;
+
+        sync_wait_task
+        get_return_object() noexcept
+        {
+            return sync_wait_task(std::coroutine_handle<
+                promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always
+        initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        auto
+        final_suspend() noexcept
+        {
+            struct awaiter
+            {
+                bool await_ready() noexcept
+                {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<
+                    promise_type> h) noexcept
+                {
+                    auto& st = *h.promise().st;
+                    std::lock_guard<std::mutex> lock(st.m);
+                    st.done = true;
+                    st.cv.notify_one();
+                }
+
+                void await_resume() noexcept
+                {
+                }
+            };
+            return awaiter{};
+        }
+
+        void
+        return_void() noexcept
+        {
+        }
+
+        void
+        unhandled_exception() noexcept
+        {
+            st->ep = std::current_exception();
+        }
+    };
+
+    sync_wait_task(sync_wait_task&& other) noexcept
+        : h_(std::exchange(other.h_, nullptr))
+    {
+    }
+
+    ~sync_wait_task()
+    {
+        if(h_)
+            h_.destroy();
+    }
+
+    std::size_t
+    wait(state& st)
+    {
+        h_.promise().st = &st;
+        h_.resume();
+        std::unique_lock<std::mutex> lock(st.m);
+        st.cv.wait(lock, [&st]{ return st.done; });
+        if(st.ep)
+            std::rethrow_exception(st.ep);
+        return st.result;
+    }
+
+private:
+    explicit
+    sync_wait_task(
+        std::coroutine_handle<promise_type> h) noexcept
+        : h_(h)
+    {
+    }
+
+    std::coroutine_handle<promise_type> h_;
+};
+
+template<class Awaitable>
+sync_wait_task
+make_sync_wait_task(
+    Awaitable&& a,
+    sync_wait_task::state& st)
+{
+    st.result = co_await std::forward<Awaitable>(a);
+}
+
+template<class Awaitable>
+std::size_t
+sync_wait(Awaitable&& a)
+{
+    sync_wait_task::state st;
+    return make_sync_wait_task(
+        std::forward<Awaitable>(a), st).wait(st);
+}
+
+} // detail
+
+/** Metafunction to detect if a type is an asynchronous read source.
+
+    Data is obtained from an asynchronous read source
+    by awaiting the result of @ref read one or more
+    times with caller-provided buffers, from a C++20
+    coroutine, until the operation completes with
+    @ref error::eof. While one stream waits for data,
+    the thread is free to make progress on others.
+
+    Unlike the synchronous @ref is_read_source, the
+    operation completes after at least one byte is
+    transferred, and may fill only part of the
+    buffers. The buffers and the error code must
+    remain valid until the operation completes, and
+    only one operation may be outstanding at a time.
+    The awaiter must accept a `std::coroutine_handle<>`
+    in `await_suspend`.
+
+    The members `size` and `rewind` are optional. The
+    metafunctions @ref has_size and @ref has_rewind
+    may be used to detect them.
+
+    @code
+    struct AsyncReadSource
+    {
+        // (optional)
+        std::uint64_t size() const noexcept;
+
+        // (optional)
+        void rewind();
+
+        // co_await yields the number of bytes read,
+        // and sets ec to error::eof when no more data
+        template< class MutableBufferSequence >
+        Awaitable
+        read(
+            MutableBufferSequence const& buffers,
+            system::error_code& ec);
+    };
+    @endcode
+
+    @par Availability
+    This is defined when the compiler supports
+    C++20 coroutines.
+*/
+template<class T, class = void>
+struct is_async_read_source
+    : std::false_type
+{
+};
+
+template<class T>
+struct is_async_read_source<T, detail::void_t<
+    typename std::enable_if<
+        detail::is_size_awaitable<decltype(
+            std::declval<T&>().read(
+                std::declval<mutable_buffer>(),
+                std::declval<system::error_code&>()))
+                    >::value>::type>>
+    : std::true_type
+{
+};
+
+//-----------------------------------------------
+
+/** An asynchronous read source which reads from a read source.
+
+    Each operation reads from the synchronous source
+    on the awaiting thread, and completes without
+    suspending. This lets a synchronous source, such
+    as a file or a memory buffer, be used where an
+    asynchronous read source is expected.
+
+    @tparam ReadSource A type which satisfies
+    @ref is_read_source.
+*/
+template<class ReadSource>
+class async_read_source
+{
+    static_assert(is_read_source<ReadSource>::value,
+        "ReadSource requirements not met");
+
+    ReadSource source_;
+
+public:
+    template<class MutableBufferSequence>
+    class awaitable
+    {
+        ReadSource* source_;
+        MutableBufferSequence const* dest_;
+        system::error_code* ec_;
+
+        friend class async_read_source;
+
+        awaitable(
+            ReadSource& source,
+            MutableBufferSequence const& dest,
+            system::error_code& ec) noexcept
+            : source_(&source)
+            , dest_(&dest)
+            , ec_(&ec)
+        {
+        }
+
+    public:
+        bool
+        await_ready() const noexcept
+        {
+            return true;
+        }
+
+        void
+        await_suspend(
+            std::coroutine_handle<>) const noexcept
+        {
+        }
+
+        std::size_t
+        await_resume()
+        {
+            return source_->read(*dest_, *ec_);
+        }
+    };
+
+    /** Constructor.
+
+        @param source The source to read from,
+        which is moved or copied.
+    */
+    template<class ReadSource_>
+    requires std::is_constructible_v<
+        ReadSource, ReadSource_>
+    explicit
+    async_read_source(
+        ReadSource_&& source)
+        : source_(std::forward<ReadSource_>(source))
+    {
+    }
+
+    /** Return the underlying source.
+    */
+    ReadSource&
+    source() noexcept
+    {
+        return source_;
+    }
+
+    /** Return the size of the source.
+    */
+    std::uint64_t
+    size() const
+        requires has_size<ReadSource>::value
+    {
+        return source_.size();
+    }
+
+    /** Restart the source from the beginning.
+    */
+    void
+    rewind()
+        requires has_rewind<ReadSource>::value
+    {
+        source_.rewind();
+    }
+
+    /** Read from the source.
+
+        The returned awaitable refers to `dest` and
+        `ec`, which must remain valid until it is
+        awaited.
+    */
+    template<class MutableBufferSequence>
+    awaitable<MutableBufferSequence>
+    read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec) noexcept
+    {
+        return awaitable<MutableBufferSequence>(
+            source_, dest, ec);
+    }
+};
+
+template<class ReadSource>
+async_read_source(ReadSource&&) ->
+    async_read_source<std::decay_t<ReadSource>>;
+
+//-----------------------------------------------
+
+/** A read source which reads from an asynchronous read source.
+
+    Each call to @ref read awaits operations of the
+    asynchronous source until the buffers are full
+    or an error occurs, blocking the calling thread
+    in the meantime. The asynchronous source must
+    complete its operations inline, or by resuming
+    them on another thread; if completion depends on
+    an event loop run by the calling thread, the
+    call never returns. Each operation allocates one
+    coroutine frame.
+
+    @tparam AsyncReadSource A type which satisfies
+    @ref is_async_read_source.
+*/
+template<class AsyncReadSource>
+class sync_read_source
+{
+    static_assert(is_async_read_source<AsyncReadSource>::value,
+        "AsyncReadSource requirements not met");
+
+    AsyncReadSource source_;
+
+public:
+    /** Constructor.
+
+        @param source The source to read from,
+        which is moved or copied.
+    */
+    template<class AsyncReadSource_>
+    requires std::is_constructible_v<
+        AsyncReadSource, AsyncReadSource_>
+    explicit
+    sync_read_source(
+        AsyncReadSource_&& source)
+        : source_(std::forward<AsyncReadSource_>(source))
+    {
+    }
+
+    /** Return the underlying source.
+    */
+    AsyncReadSource&
+    source() noexcept
+    {
+        return source_;
+    }
+
+    /** Return the size of the source.
+    */
+    std::uint64_t
+    size() const
+        requires has_size<AsyncReadSource>::value
+    {
+        return source_.size();
+    }
+
+    /** Restart the source from the beginning.
+    */
+    void
+    rewind()
+        requires has_rewind<AsyncReadSource>::value
+    {
+        source_.rewind();
+    }
+
+    /** Read from the source.
+
+        @return The number of bytes read, which is
+        the size of `dest` unless `ec` is set.
+    */
+    template<class MutableBufferSequence>
+    std::size_t
+    read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        std::size_t total = 0;
+        auto const n = buffers::size(dest);
+        while(total < n)
+        {
+            auto const rest = sans_prefix(dest, total);
+            auto const nread = detail::sync_wait(
+                source_.read(rest, ec));
+            total += nread;
+            if(ec.failed())
+                break;
+            BOOST_ASSERT(nread != 0);
+        }
+        return total;
+    }
+};
+
+template<class AsyncReadSource>
+sync_read_source(AsyncReadSource&&) ->
+    sync_read_source<std::decay_t<AsyncReadSource>>;
+
+} // buffers
+} // boost
+
+#endif
+
+#endif
@@ -0,0 +1,353 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_BLOCK_POOL_HPP
+#define BOOST_BUFFERS_BLOCK_POOL_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/detail/except.hpp>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#if ! defined(BOOST_NO_CXX17_HDR_MEMORY_RESOURCE) && ( \
+    __cplusplus >= 201703L || \
+    (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+# define BOOST_BUFFERS_HAS_MEMORY_RESOURCE
+# include <memory_resource>
+#endif
+
+namespace boost {
+namespace buffers {
+
+namespace detail {
+struct block_pool_core;
+} // detail
+
+/** A thread-safe pool of fixed-size blocks.
+
+    Each thread keeps a small cache of free blocks,
+    so allocating and deallocating on the same thread
+    does not take a lock. When a thread's cache is
+    empty it refills from a shared depot, and when
+    the cache overflows half of it is returned to
+    the depot. The depot retains at most a configured
+    number of blocks; blocks beyond that are returned
+    to the global allocator. When a thread exits, its
+    cache is returned to the depot.
+
+    Blocks are aligned for any fundamental type.
+
+    The pool must outlive every block allocated from
+    it, and must not be destroyed while other threads
+    are using it.
+
+    @see block_pool_allocator
+*/
+class block_pool
+{
+    std::shared_ptr<detail::block_pool_core> core_;
+
+public:
+    /** Counters describing the use of the pool.
+    */
+    struct stats
+    {
+        /// Allocations served from a cache or the depot
+        std::size_t hits = 0;
+
+        /// Allocations served by the global allocator
+        std::size_t misses = 0;
+
+        /// Free blocks held by the depot and the caches
+        std::size_t retained = 0;
+    };
+
+    /** Destructor.
+
+        All retained blocks are deallocated.
+    */
+    BOOST_BUFFERS_DECL
+    ~block_pool();
+
+    /** Constructor.
+
+        @param block_size The number of bytes in
+        each block.
+
+        @param max_retained The largest number of
+        free blocks kept by the depot.
+
+        @param cache_size The largest number of free
+        blocks kept by the cache of each thread.
+
+        @throw std::invalid_argument `block_size == 0`.
+    */
+    BOOST_BUFFERS_DECL
+    explicit
+    block_pool(
+        std::size_t block_size,
+        std::size_t max_retained = 1024,
+        std::size_t cache_size = 64);
+
+    block_pool(block_pool const&) = delete;
+    block_pool& operator=(block_pool const&) = delete;
+
+    /** Return the number of bytes in each block.
+    */
+    BOOST_BUFFERS_DECL
+    std::size_t
+    block_size() const noexcept;
+
+    /** Return a block.
+
+        @throw std::bad_alloc if a new block is
+        needed and cannot be allocated.
+    */
+    BOOST_BUFFERS_DECL
+    void*
+    allocate();
+
+    /** Return a block to the pool.
+
+        @param p A block previously returned by
+        @ref allocate on this pool.
+    */
+    BOOST_BUFFERS_DECL
+    void
+    deallocate(void* p) noexcept;
+
+    /** Return the counters of the pool.
+
+        The values are a snapshot and may be
+        slightly out of date when other threads
+        are using the pool.
+    */
+    BOOST_BUFFERS_DECL
+    stats
+    get_stats() const noexcept;
+
+    /** Deallocate the free blocks of the depot and the calling thread.
+    */
+    BOOST_BUFFERS_DECL
+    void
+    trim() noexcept;
+};
+
+//------------------------------------------------
+
+/** An Allocator which obtains its storage from a block pool.
+
+    Allocations which fit in one block are served by
+    the pool. Larger allocations use the global
+    allocator. This can be used with the owning
+    buffers of the library, for example:
+
+    @code
+    block_pool pool( 4096 + 64 );
+    basic_segmented_buffer< block_pool_allocator< unsigned char > > b(
+        4096, block_pool_allocator< unsigned char >( pool ) );
+    @endcode
+
+    @tparam T The type of value allocated.
+*/
+template<class T>
+class block_pool_allocator
+{
+    static_assert(
+        alignof(T) <= alignof(std::max_align_t),
+        "over-aligned types are not supported");
+
+    block_pool* pool_;
+
+    template<class U>
+    friend class block_pool_allocator;
+
+public:
+    using value_type = T;
+
+    /** Constructor.
+
+        @param pool The pool to use. It must outlive
+        the allocator and all of its copies.
+    */
+    explicit
+    block_pool_allocator(
+        block_pool& pool) noexcept
+        : pool_(&pool)
+    {
+    }
+
+    /** Constructor.
+    */
+    template<class U>
+    block_pool_allocator(
+        block_pool_allocator<U> const& other) noexcept
+        : pool_(other.pool_)
+    {
+    }
+
+    /** Return the pool.
+    */
+    block_pool&
+    pool() const noexcept
+    {
+        return *pool_;
+    }
+
+    /** Allocate storage for `n` objects.
+    */
+    T*
+    allocate(std::size_t n)
+    {
+        if(n > std::size_t(-1) / sizeof(T))
+            detail::throw_length_error();
+        if(n * sizeof(T) <= pool_->block_size())
+            return static_cast<T*>(pool_->allocate());
+        return static_cast<T*>(
+            ::operator new(n * sizeof(T)));
+    }
+
+    /** Deallocate storage for `n` objects.
+    */
+    void
+    deallocate(
+        T* p, std::size_t n) noexcept
+    {
+        if(n * sizeof(T) <= pool_->block_size())
+            pool_->deallocate(p);
+        else
+            ::operator delete(p);
+    }
+
+    /** Return true if both allocators use the same pool.
+    */
+    template<class U>
+    bool
+    operator==(
+        block_pool_allocator<U> const& other) const noexcept
+    {
+        return pool_ == other.pool_;
+    }
+
+    /** Return true if the allocators use different pools.
+    */
+    template<class U>
+    bool
+    operator!=(
+        block_pool_allocator<U> const& other) const noexcept
+    {
+        return pool_ != other.pool_;
+    }
+};
+
+//------------------------------------------------
+
+#ifdef BOOST_BUFFERS_HAS_MEMORY_RESOURCE
+
+/** A memory resource which obtains its storage from a block pool.
+
+    Allocations which fit in one block and need no
+    more than fundamental alignment are served by
+    the pool. Other allocations are forwarded to
+    the upstream resource.
+*/
+class block_pool_resource
+    : public std::pmr::memory_resource
+{
+    block_pool* pool_;
+    std::pmr::memory_resource* upstream_;
+
+public:
+    /** Constructor.
+
+        @param pool The pool to use. It must outlive
+        the resource.
+
+        @param upstream The resource used for
+        allocations which the pool cannot serve.
+    */
+    explicit
+    block_pool_resource(
+        block_pool& pool,
+        std::pmr::memory_resource* upstream =
+            std::pmr::get_default_resource()) noexcept
+        : pool_(&pool)
+        , upstream_(upstream)
+    {
+    }
+
+    /** Return the pool.
+    */
+    block_pool&
+    pool() const noexcept
+    {
+        return *pool_;
+    }
+
+    /** Return the upstream resource.
+    */
+    std::pmr::memory_resource*
+    upstream_resource() const noexcept
+    {
+        return upstream_;
+    }
+
+private:
+    bool
+    from_pool(
+        std::size_t bytes,
+        std::size_t align) const noexcept
+    {
+        return
+            bytes <= pool_->block_size() &&
+            align <= alignof(std::max_align_t);
+    }
+
+    void*
+    do_allocate(
+        std::size_t bytes,
+        std::size_t align) override
+    {
+        if(from_pool(bytes, align))
+            return pool_->allocate();
+        return upstream_->allocate(bytes, align);
+    }
+
+    void
+    do_deallocate(
+        void* p,
+        std::size_t bytes,
+        std::size_t align) override
+    {
+        if(from_pool(bytes, align))
+            pool_->deallocate(p);
+        else
+            upstream_->deallocate(p, bytes, align);
+    }
+
+    bool
+    do_is_equal(
+        std::pmr::memory_resource const& other) const noexcept override
+    {
+        auto const p = dynamic_cast<
+            block_pool_resource const*>(&other);
+        return
+            p != nullptr &&
+            p->pool_ == pool_ &&
+            p->upstream_->is_equal(*upstream_);
+    }
+};
+
+#endif
+
+} // buffers
+} // boost
+
+#endif
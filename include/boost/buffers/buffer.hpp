@@ -149,7 +149,29 @@ enum class slice_how
     remove_prefix,
 
     /// Indicates that the front of the buffer sequence should be preserved
-    keep_prefix
+    keep_prefix,
+
+    /// Indicates that the back of the buffer sequence should be trimmed
+    remove_suffix,
+
+    /// Indicates that the back of the buffer sequence should be preserved
+    keep_suffix
+};
+
+/** Metafunction indicating that a type slices its suffix natively
+
+    Customizations of slicing are only required to handle
+    @ref slice_how::remove_prefix and @ref slice_how::keep_prefix.
+    Types whose `tag_invoke` overload also handles
+    @ref slice_how::remove_suffix and @ref slice_how::keep_suffix
+    specialize this to derive from `std::true_type`. Otherwise, the
+    suffix algorithms measure the sequence and trim the prefix.
+
+    @tparam T The type to check.
+*/
+template<class T>
+struct has_suffix_slice : std::false_type
+{
 };
 
 //------------------------------------------------
@@ -241,6 +263,20 @@ private:
             if( n < n_)
                 n_ = n;
             return;
+
+        case slice_how::remove_suffix:
+            if( n > n_)
+                n = n_;
+            n_ -= n;
+            return;
+
+        case slice_how::keep_suffix:
+            if( n < n_)
+            {
+                p_ += n_ - n;
+                n_ = n;
+            }
+            return;
         }
     }
 };
@@ -346,6 +382,20 @@ private:
             if( n < n_)
                 n_ = n;
             return;
+
+        case slice_how::remove_suffix:
+            if( n > n_)
+                n = n_;
+            n_ -= n;
+            return;
+
+        case slice_how::keep_suffix:
+            if( n < n_)
+            {
+                p_ += n_ - n;
+                n_ = n;
+            }
+            return;
         }
     }
 };
@@ -396,6 +446,20 @@ public:
             if(n < b.n_)
                 b.n_ = n;
             return;
+
+        case slice_how::remove_suffix:
+            if(n > b.n_)
+                n = b.n_;
+            b.n_ -= n;
+            return;
+
+        case slice_how::keep_suffix:
+            if(n < b.n_)
+            {
+                b.p_ = static_cast<T*>(b.p_) + (b.n_ - n);
+                b.n_ = n;
+            }
+            return;
         }
     }
 
@@ -414,6 +478,18 @@ using const_buffer = basic_buffer<unsigned char const>;
 
 #endif
 
+template<>
+struct has_suffix_slice<mutable_buffer>
+    : std::true_type
+{
+};
+
+template<>
+struct has_suffix_slice<const_buffer>
+    : std::true_type
+{
+};
+
 //------------------------------------------------------------------------------
 
 /** Return an iterator pointing to the first element of a buffer sequence
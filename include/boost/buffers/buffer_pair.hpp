@@ -41,6 +41,18 @@ tag_invoke(
     slice_how how,
     std::size_t n) noexcept;
 
+template<>
+struct has_suffix_slice<const_buffer_pair>
+    : std::true_type
+{
+};
+
+template<>
+struct has_suffix_slice<mutable_buffer_pair>
+    : std::true_type
+{
+};
+
 } // buffers
 } // boost
 
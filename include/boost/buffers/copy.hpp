@@ -18,11 +18,96 @@
 namespace boost {
 namespace buffers {
 
+namespace detail {
+
+// Sequences which copy their buffers
+// out in batches, such as any_buffers
+template<class T, class = void>
+struct has_fetch : std::false_type
+{
+};
+
+template<class T>
+struct has_fetch<T, void_t<decltype(
+    std::declval<T const&>().fetch(
+        std::declval<typename T::const_iterator&>(),
+        std::declval<typename T::value_type*>(),
+        std::size_t()))>>
+    : std::true_type
+{
+};
+
+// Visits the buffers of a sequence in order
+template<class T, bool = has_fetch<T>::value>
+class copy_cursor
+{
+    decltype(buffers::begin(std::declval<T const&>())) it_;
+    decltype(buffers::end(std::declval<T const&>())) end_;
+
+public:
+    explicit
+    copy_cursor(T const& bs)
+        : it_(buffers::begin(bs))
+        , end_(buffers::end(bs))
+    {
+    }
+
+    template<class Buffer>
+    bool
+    next(Buffer& b)
+    {
+        if(it_ == end_)
+            return false;
+        b = *it_;
+        ++it_;
+        return true;
+    }
+};
+
+// One call for every 16 buffers
+template<class T>
+class copy_cursor<T, true>
+{
+    T const& bs_;
+    typename T::const_iterator it_;
+    typename T::value_type v_[16];
+    std::size_t i_ = 0;
+    std::size_t n_ = 0;
+
+public:
+    explicit
+    copy_cursor(T const& bs)
+        : bs_(bs)
+        , it_(bs.begin())
+    {
+    }
+
+    template<class Buffer>
+    bool
+    next(Buffer& b)
+    {
+        if(i_ == n_)
+        {
+            n_ = bs_.fetch(it_, v_, 16);
+            i_ = 0;
+            if(n_ == 0)
+                return false;
+        }
+        b = v_[i_++];
+        return true;
+    }
+};
+
+} // detail
+
 /** Copy the contents of a buffer sequence into another buffer sequence
 
     This function copies no more than `at_most` bytes from the constant buffer
     sequence denoted by `src` into the mutable buffer sequence denoted by `dest`.
 
+    Sequences which provide a `fetch` member, such as @ref any_buffers, are
+    visited in batches of buffers, with one call to `fetch` for each batch.
+
     @par Constraints
     @code
     requires is_mutable_buffer_sequence_v<decltype(dest)> &&
@@ -50,55 +135,30 @@ constexpr struct copy_mrdocs_workaround_t
             is_const_buffer_sequence<ConstBufferSequence>::value, std::size_t>::type
     {
         std::size_t total = 0;
-        std::size_t pos0 = 0;
-        std::size_t pos1 = 0;
-        auto const end0 = end(src);
-        auto const end1 = end(dest);
-        auto it0 = begin(src);
-        auto it1 = begin(dest);
-        while(
-            total < at_most &&
-            it0 != end0 &&
-            it1 != end1)
+        detail::copy_cursor<ConstBufferSequence> c0(src);
+        detail::copy_cursor<MutableBufferSequence> c1(dest);
+        const_buffer b0;
+        mutable_buffer b1;
+        while(total < at_most)
         {
-            const_buffer b0 = *it0;
-            mutable_buffer b1 = *it1;
-            b0 += pos0;
-            b1 += pos1;
-            std::size_t const amount =
-            [&]
-            {
-                std::size_t n = b0.size();
-                if( n > b1.size())
-                    n = b1.size();
-                if( n > at_most - total)
-                    n = at_most - total;
-                if(n != 0)
-                    std::memcpy(
-                        b1.data(),
-                        b0.data(),
-                        n);
-                return n;
-            }();
-            total += amount;
-            if(amount == b1.size())
-            {
-                ++it1;
-                pos1 = 0;
-            }
-            else
-            {
-                pos1 += amount;
-            }
-            if(amount == b0.size())
-            {
-                ++it0;
-                pos0 = 0;
-            }
-            else
-            {
-                pos0 += amount;
-            }
+            while(b0.size() == 0)
+                if(! c0.next(b0))
+                    return total;
+            while(b1.size() == 0)
+                if(! c1.next(b1))
+                    return total;
+            std::size_t n = b0.size();
+            if( n > b1.size())
+                n = b1.size();
+            if( n > at_most - total)
+                n = at_most - total;
+            std::memcpy(
+                b1.data(),
+                b0.data(),
+                n);
+            b0 += n;
+            b1 += n;
+            total += n;
         }
         return total;
     }
@@ -58,6 +58,13 @@ namespace buffers {
     return ::boost::system::error_code((ev), &loc ## __LINE__)
 #endif
 
+// C++20 coroutines
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+# if __has_include(<coroutine>)
+#  define BOOST_BUFFERS_HAS_COROUTINES
+# endif
+#endif
+
 //------------------------------------------------
 
 // avoid all of Boost.TypeTraits for just this
@@ -12,6 +12,7 @@
 
 #include <boost/buffers/detail/config.hpp>
 #include <boost/assert/source_location.hpp>
+#include <boost/system/error_code.hpp>
 
 namespace boost {
 namespace buffers {
@@ -29,6 +30,13 @@ BOOST_NORETURN
 throw_length_error(
     source_location const& loc = BOOST_CURRENT_LOCATION);
 
+BOOST_BUFFERS_DECL
+void
+BOOST_NORETURN
+throw_system_error(
+    system::error_code const& ec,
+    source_location const& loc = BOOST_CURRENT_LOCATION);
+
 } // detail
 } // buffers
 } // boost
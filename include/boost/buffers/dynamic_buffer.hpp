@@ -13,7 +13,10 @@
 #include <boost/buffers/detail/config.hpp>
 #include <boost/buffers/buffer.hpp>
 #include <boost/core/span.hpp>
+#include <algorithm>
 #include <cstdlib>
+#include <iterator>
+#include <memory>
 
 namespace boost {
 namespace buffers {
@@ -71,7 +74,97 @@ struct BOOST_SYMBOL_VISIBLE
 
 //-----------------------------------------------
 
+namespace detail {
+
+// The elements of a buffer sequence, copied into an
+// array which is stored inline up to N elements and
+// on the heap beyond that. The heap array is kept
+// for reuse. Copies of a cache are empty.
+template<class Buffer, std::size_t N>
+class unroll_cache
+{
+    Buffer inline_[N];
+    std::unique_ptr<Buffer[]> heap_;
+    std::size_t cap_ = 0;
+    std::size_t len_ = 0;
+    bool valid_ = false;
+
+public:
+    unroll_cache() = default;
+
+    unroll_cache(unroll_cache const&) noexcept
+    {
+    }
+
+    unroll_cache&
+    operator=(unroll_cache const&) noexcept
+    {
+        valid_ = false;
+        return *this;
+    }
+
+    bool
+    valid() const noexcept
+    {
+        return valid_;
+    }
+
+    void
+    invalidate() noexcept
+    {
+        valid_ = false;
+    }
+
+    span<Buffer const>
+    get() const noexcept
+    {
+        return { len_ > N ? heap_.get() : inline_, len_ };
+    }
+
+    template<class BufferSequence>
+    span<Buffer const>
+    assign(BufferSequence const& bs)
+    {
+        valid_ = false;
+        std::size_t i = 0;
+        auto it = buffers::begin(bs);
+        auto const end_ = buffers::end(bs);
+        for(; it != end_ && i < N; ++it)
+            inline_[i++] = *it;
+        if(it != end_)
+        {
+            // spill to the heap
+            auto const n = i + static_cast<std::size_t>(
+                std::distance(it, end_));
+            if(cap_ < n)
+            {
+                auto const cap = (std::max)(n, 2 * cap_);
+                heap_.reset(new Buffer[cap]);
+                cap_ = cap;
+            }
+            std::copy(inline_, inline_ + i, heap_.get());
+            for(; it != end_; ++it)
+                heap_[i++] = *it;
+        }
+        len_ = i;
+        valid_ = true;
+        return get();
+    }
+};
+
+} // detail
+
 /** A type-erased dynamic buffer.
+
+    The buffer sequences of the wrapped dynamic buffer
+    are copied into arrays of buffers, which hold up
+    to `N` elements inline and spill to the heap beyond
+    that. The readable bytes are copied when @ref data
+    is called after the buffer is modified, so that
+    modifying the buffer costs nothing extra when the
+    sequence is not observed. Because @ref data updates
+    this copy, concurrent calls to it on the same
+    object are not safe.
 */
 template<
     class DynamicBuffer,
@@ -80,29 +173,8 @@ class any_dynamic_buffer_impl
     : public any_dynamic_buffer
 {
     DynamicBuffer b_;
-    const_buffer data_[N];
-    mutable_buffer out_[N];
-    std::size_t data_len_ = 0;
-    std::size_t out_len_ = 0;
-
-    template<class ConstBufferSequence, class BufferType>
-    static
-    std::size_t
-    unroll(
-        ConstBufferSequence const& bs,
-        BufferType* dest,
-        std::size_t len)
-    {
-        std::size_t i = 0;
-        auto const end_ = end(bs);
-        for(auto it = begin(bs); it != end_; ++it)
-        {
-            dest[i++] = *it;
-            if(i == len)
-                break;
-        }
-        return i;
-    }
+    mutable detail::unroll_cache<const_buffer, N> data_;
+    detail::unroll_cache<mutable_buffer, N> out_;
 
 public:
     template<class DynamicBuffer_>
@@ -113,9 +185,15 @@ public:
     {
     }
 
+    /** Return the wrapped buffer.
+
+        The returned reference may be used to modify
+        the buffer.
+    */
     DynamicBuffer&
     buffer() noexcept
     {
+        data_.invalidate();
         return b_;
     }
 
@@ -146,8 +224,9 @@ public:
     const_buffers_type
     data() const override
     {
-        return const_buffers_type(
-            data_, data_len_);
+        if(data_.valid())
+            return data_.get();
+        return data_.assign(b_.data());
     }
 
     auto
@@ -155,28 +234,25 @@ public:
         std::size_t n) ->
             mutable_buffers_type override
     {
-        out_len_ = unroll(
-            b_.prepare(n), out_, N);
-        return mutable_buffers_type(
-            out_, out_len_);
+        // preparing can move the readable bytes
+        data_.invalidate();
+        return out_.assign(b_.prepare(n));
     }
 
     void
     commit(
         std::size_t n) override
     {
+        data_.invalidate();
         b_.commit(n);
-        data_len_ = unroll(
-            b_.data(), data_, N);
     }
 
     void
     consume(
         std::size_t n) override
     {
+        data_.invalidate();
         b_.consume(n);
-        data_len_ = unroll(
-            b_.data(), data_, N);
     }
 };
 
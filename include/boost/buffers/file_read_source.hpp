@@ -0,0 +1,243 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_FILE_READ_SOURCE_HPP
+#define BOOST_BUFFERS_FILE_READ_SOURCE_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/aligned_buffer.hpp>
+#include <boost/buffers/iovec.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <boost/buffers/error.hpp>
+#include <boost/system/error_code.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace buffers {
+
+/** A read source which reads a file.
+
+    The bytes of a file are read with `preadv`
+    directly into the caller's buffers, one system
+    call for each batch of buffers. This satisfies
+    @ref is_read_source, and provides the optional
+    members `size` and `rewind`.
+
+    In direct mode the file is opened for unbuffered
+    I/O, bypassing the page cache, so that reading
+    a large file once does not evict other data
+    from memory. The system then requires that the
+    address and size of each buffer be a multiple
+    of the logical block size of the device, which
+    @ref aligned_buffer provides, or the read fails
+    with `errc::invalid_argument`. Since every read
+    except the last fills the buffers completely,
+    the file offset stays aligned as well.
+
+    The size of the file is determined when it is
+    opened. Only regular files can be read; use
+    @ref uring_read_source for pipes and other
+    streams. Objects are move-only.
+
+    @par Example
+    @code
+    file_read_source::options opt;
+    opt.direct = true;
+    file_read_source src( "export.bin", opt );
+    aligned_buffer buf( 1024 * 1024 );
+    system::error_code ec;
+    do
+    {
+        auto const n = src.read( buf, ec );
+        consume( buf.data(), n );
+    }
+    while( ! ec.failed() );
+    @endcode
+
+    @par Platform
+    This is available on POSIX systems. Direct mode
+    uses `O_DIRECT` where it is defined, otherwise
+    `F_NOCACHE`, otherwise the page cache.
+*/
+class file_read_source
+{
+    int fd_ = -1;
+    std::uint64_t size_ = 0;
+    std::uint64_t pos_ = 0;
+
+public:
+    /** Options used when opening a file.
+    */
+    struct options
+    {
+        /// Bypass the page cache
+        bool direct = false;
+    };
+
+    /** Destructor.
+    */
+    BOOST_BUFFERS_DECL
+    ~file_read_source();
+
+    /** Constructor.
+
+        Default-constructed objects are empty, and
+        every read returns @ref error::eof.
+    */
+    file_read_source() = default;
+
+    /** Constructor.
+
+        The file is opened for reading.
+
+        @param path The path of the file.
+
+        @throw system::system_error if the file
+        cannot be opened.
+    */
+    explicit
+    file_read_source(
+        char const* path)
+        : file_read_source(path, options())
+    {
+    }
+
+    /** Constructor.
+
+        The file is opened for reading.
+
+        @param path The path of the file.
+
+        @param opt The options for the file.
+
+        @throw system::system_error if the file
+        cannot be opened, if it is not a regular
+        file, or if direct mode is requested and
+        the file system does not support it.
+    */
+    BOOST_BUFFERS_DECL
+    file_read_source(
+        char const* path,
+        options const& opt);
+
+    /** Constructor.
+
+        The new object takes ownership of the file,
+        and `other` is left empty.
+    */
+    file_read_source(
+        file_read_source&& other) noexcept
+        : fd_(other.fd_)
+        , size_(other.size_)
+        , pos_(other.pos_)
+    {
+        other.fd_ = -1;
+        other.size_ = 0;
+        other.pos_ = 0;
+    }
+
+    /** Assignment.
+
+        The file of `*this` is closed, and
+        `other` is left empty.
+    */
+    file_read_source&
+    operator=(
+        file_read_source&& other) noexcept
+    {
+        if(this != &other)
+        {
+            file_read_source tmp(std::move(*this));
+            fd_ = other.fd_;
+            size_ = other.size_;
+            pos_ = other.pos_;
+            other.fd_ = -1;
+            other.size_ = 0;
+            other.pos_ = 0;
+        }
+        return *this;
+    }
+
+    file_read_source(
+        file_read_source const&) = delete;
+
+    file_read_source& operator=(
+        file_read_source const&) = delete;
+
+    /** Return the size of the file in bytes.
+    */
+    std::uint64_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Restart reading from the beginning of the file.
+    */
+    void
+    rewind() noexcept
+    {
+        pos_ = 0;
+    }
+
+    /** Read from the file.
+
+        Bytes are read from the current position
+        until the buffers are full or the end of the
+        file is reached.
+
+        @return The number of bytes read.
+
+        @param dest The buffers to read into.
+
+        @param ec Set to @ref error::eof when the
+        last byte of the file has been read, or to
+        the error from the system call.
+    */
+    template<class MutableBufferSequence>
+    std::size_t
+    read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        std::size_t total = 0;
+        ::iovec v[batch_size];
+        iovec_cursor<MutableBufferSequence> c(dest);
+        while(! c.empty())
+        {
+            auto const iov = c.prepare(v, batch_size);
+            auto const n = do_read(iov.data(), iov.size(), ec);
+            total += n;
+            if(ec.failed())
+                return total;
+            c.consume(n);
+        }
+        return total;
+    }
+
+private:
+    static constexpr std::size_t batch_size =
+        iov_max < 64 ? iov_max : 64;
+
+    BOOST_BUFFERS_DECL
+    std::size_t
+    do_read(
+        ::iovec const* iov,
+        std::size_t n,
+        system::error_code& ec);
+};
+
+} // buffers
+} // boost
+
+#endif
+
+#endif
@@ -13,6 +13,7 @@
 #include <boost/buffers/detail/config.hpp>
 #include <boost/buffers/buffer.hpp>
 #include <boost/buffers/detail/except.hpp>
+#include <cstring>
 
 namespace boost {
 namespace buffers {
@@ -21,6 +22,14 @@ namespace buffers {
 
     Buffer sequences returned by this container
     always have a single element.
+
+    By default, space before the readable bytes is
+    only reclaimed when they are all consumed. When
+    automatic compaction is enabled with @ref auto_compact,
+    the readable bytes are moved to the front of the
+    storage as needed, so the full capacity stays
+    available. In this mode @ref prepare and @ref consume
+    invalidate buffer sequences obtained from @ref data.
 */
 class flat_buffer
 {
@@ -29,6 +38,9 @@ class flat_buffer
     std::size_t in_pos_ = 0;
     std::size_t in_size_ = 0;
     std::size_t out_size_ = 0;
+    std::size_t threshold_ = 0;
+    std::size_t moved_ = 0;
+    bool auto_compact_ = false;
 
 public:
     using const_buffers_type = const_buffer;
@@ -90,9 +102,60 @@ public:
     std::size_t
     capacity() const noexcept
     {
+        if(auto_compact_)
+            return cap_ - in_size_;
         return cap_ - (in_pos_ + in_size_);
     }
 
+    /** Set the automatic compaction policy.
+
+        When enabled, @ref prepare compacts the buffer if
+        the requested bytes do not fit after the readable
+        bytes, and @ref consume compacts the buffer once
+        the number of bytes before the readable bytes
+        reaches `threshold`.
+
+        @param enable `true` to enable automatic compaction.
+        @param threshold The consumed byte count which
+            triggers compaction in @ref consume. The default
+            compacts only when @ref prepare needs the space.
+    */
+    void
+    auto_compact(
+        bool enable,
+        std::size_t threshold = std::size_t(-1)) noexcept
+    {
+        auto_compact_ = enable;
+        threshold_ = threshold;
+    }
+
+    /** Move the readable bytes to the front of the storage.
+
+        Buffer sequences previously obtained using
+        @ref data or @ref prepare become invalid.
+
+        @return The number of bytes moved.
+    */
+    std::size_t
+    compact() noexcept
+    {
+        if(in_pos_ == 0)
+            return 0;
+        if(in_size_ > 0)
+            std::memmove(data_, data_ + in_pos_, in_size_);
+        in_pos_ = 0;
+        moved_ += in_size_;
+        return in_size_;
+    }
+
+    /** Return the total number of bytes moved by compaction.
+    */
+    std::size_t
+    bytes_moved() const noexcept
+    {
+        return moved_;
+    }
+
     /** Returns a constant buffer sequence representing the readable bytes.
     */
     const_buffers_type
@@ -115,6 +178,9 @@ public:
         if( n > capacity() )
             detail::throw_invalid_argument();
 
+        if( n > cap_ - (in_pos_ + in_size_) )
+            compact();
+
         out_size_ = n;
         return mutable_buffers_type(
             data_ + in_pos_ + in_size_, n);
@@ -145,6 +211,9 @@ public:
         {
             in_pos_ += n;
             in_size_ -= n;
+            if( auto_compact_ &&
+                in_pos_ >= threshold_)
+                compact();
         }
         else
         {
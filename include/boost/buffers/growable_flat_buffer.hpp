@@ -0,0 +1,470 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_GROWABLE_FLAT_BUFFER_HPP
+#define BOOST_BUFFERS_GROWABLE_FLAT_BUFFER_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/buffer.hpp>
+#include <boost/buffers/detail/except.hpp>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace boost {
+namespace buffers {
+
+/** A DynamicBuffer which owns contiguous, growable storage.
+
+    Buffer sequences returned by this container
+    always have a single element. When @ref prepare
+    needs more space than follows the readable bytes,
+    the readable bytes are first moved to the front of
+    the storage. The storage is reallocated only when
+    that is not enough, growing geometrically up to
+    @ref max_size.
+
+    Calls to @ref prepare, @ref reserve and
+    @ref shrink_to_fit invalidate buffer sequences
+    previously obtained from @ref data.
+
+    @tparam Allocator The allocator used for the storage.
+*/
+template<class Allocator = std::allocator<unsigned char>>
+class basic_growable_flat_buffer
+{
+    using alloc_type = typename
+        std::allocator_traits<Allocator>::
+            template rebind_alloc<unsigned char>;
+
+    using alloc_traits =
+        std::allocator_traits<alloc_type>;
+
+    alloc_type alloc_;
+    unsigned char* data_ = nullptr;
+    std::size_t cap_ = 0;
+    std::size_t in_pos_ = 0;
+    std::size_t in_size_ = 0;
+    std::size_t out_size_ = 0;
+    std::size_t max_;
+
+public:
+    using allocator_type = Allocator;
+    using const_buffers_type = const_buffer;
+    using mutable_buffers_type = mutable_buffer;
+
+    /** Destructor.
+    */
+    ~basic_growable_flat_buffer()
+    {
+        release();
+    }
+
+    /** Constructor.
+
+        Default constructed objects have zero capacity.
+    */
+    basic_growable_flat_buffer() noexcept(
+        std::is_nothrow_default_constructible<alloc_type>::value)
+        : alloc_()
+        , max_(alloc_traits::max_size(alloc_))
+    {
+    }
+
+    /** Constructor.
+
+        @param alloc The allocator to use.
+    */
+    explicit
+    basic_growable_flat_buffer(
+        Allocator const& alloc) noexcept
+        : alloc_(alloc)
+        , max_(alloc_traits::max_size(alloc_))
+    {
+    }
+
+    /** Constructor.
+
+        @param max_size The upper limit on the size of
+            the readable and writable bytes combined.
+        @param alloc The allocator to use.
+    */
+    explicit
+    basic_growable_flat_buffer(
+        std::size_t max_size,
+        Allocator const& alloc = Allocator()) noexcept
+        : alloc_(alloc)
+        , max_(max_size)
+    {
+        if(max_ > alloc_traits::max_size(alloc_))
+            max_ = alloc_traits::max_size(alloc_);
+    }
+
+    /** Constructor.
+
+        The new object takes ownership of the storage,
+        and `other` is left with zero capacity.
+    */
+    basic_growable_flat_buffer(
+        basic_growable_flat_buffer&& other) noexcept
+        : alloc_(std::move(other.alloc_))
+        , data_(other.data_)
+        , cap_(other.cap_)
+        , in_pos_(other.in_pos_)
+        , in_size_(other.in_size_)
+        , max_(other.max_)
+    {
+        other.data_ = nullptr;
+        other.cap_ = 0;
+        other.in_pos_ = 0;
+        other.in_size_ = 0;
+        other.out_size_ = 0;
+    }
+
+    /** Constructor.
+
+        The new object holds a copy of the readable
+        bytes, in storage sized to fit them.
+    */
+    basic_growable_flat_buffer(
+        basic_growable_flat_buffer const& other)
+        : alloc_(alloc_traits::
+            select_on_container_copy_construction(
+                other.alloc_))
+        , max_(other.max_)
+    {
+        copy_from(other);
+    }
+
+    /** Assignment.
+    */
+    basic_growable_flat_buffer&
+    operator=(
+        basic_growable_flat_buffer&& other) noexcept(
+            alloc_traits::propagate_on_container_move_assignment::value)
+    {
+        if(this != &other)
+            move_assign(other, typename alloc_traits::
+                propagate_on_container_move_assignment{});
+        return *this;
+    }
+
+    /** Assignment.
+    */
+    basic_growable_flat_buffer&
+    operator=(
+        basic_growable_flat_buffer const& other)
+    {
+        if(this != &other)
+            copy_assign(other, typename alloc_traits::
+                propagate_on_container_copy_assignment{});
+        return *this;
+    }
+
+    /** Return a copy of the allocator.
+    */
+    allocator_type
+    get_allocator() const noexcept
+    {
+        return allocator_type(alloc_);
+    }
+
+    /** Return the number of readable bytes.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return in_size_;
+    }
+
+    /** Return the maximum size of the buffer.
+    */
+    std::size_t
+    max_size() const noexcept
+    {
+        return max_;
+    }
+
+    /** Return the number of writable bytes without reallocating.
+    */
+    std::size_t
+    capacity() const noexcept
+    {
+        return cap_ - in_size_;
+    }
+
+    /** Return a constant buffer sequence representing the readable bytes.
+    */
+    const_buffers_type
+    data() const noexcept
+    {
+        return const_buffers_type(
+            data_ + in_pos_, in_size_);
+    }
+
+    /** Return a mutable buffer sequence representing the writable bytes.
+
+        All buffer sequences previously obtained
+        using @ref data or @ref prepare become invalid.
+
+        @param n The desired number of bytes in the
+        returned buffer sequence.
+
+        @throws std::length_error `size() + n > max_size()`.
+    */
+    mutable_buffers_type
+    prepare(std::size_t n)
+    {
+        // n exceeds available space
+        if(n > max_ - in_size_)
+            detail::throw_length_error();
+
+        if(n > cap_ - (in_pos_ + in_size_))
+        {
+            if(n <= cap_ - in_size_)
+            {
+                compact();
+            }
+            else
+            {
+                // grow geometrically
+                auto const need = in_size_ + n;
+                auto cap = cap_;
+                if(cap > max_ - cap)
+                    cap = max_;
+                else
+                    cap += cap;
+                if(cap < need)
+                    cap = need;
+                reallocate(cap);
+            }
+        }
+        out_size_ = n;
+        return mutable_buffers_type(
+            data_ + in_pos_ + in_size_, n);
+    }
+
+    /** Commit bytes to the input sequence.
+
+        @param n The number of bytes to commit.
+    */
+    void
+    commit(
+        std::size_t n) noexcept
+    {
+        if(n < out_size_)
+            in_size_ += n;
+        else
+            in_size_ += out_size_;
+        out_size_ = 0;
+    }
+
+    /** Consume bytes from the input sequence.
+
+        @param n The number of bytes to consume.
+    */
+    void
+    consume(
+        std::size_t n) noexcept
+    {
+        if(n < in_size_)
+        {
+            in_pos_ += n;
+            in_size_ -= n;
+        }
+        else
+        {
+            in_pos_ = 0;
+            in_size_ = 0;
+        }
+        out_size_ = 0;
+    }
+
+    /** Guarantee a minimum capacity.
+
+        After the call, the total storage is at
+        least `n` bytes.
+
+        @param n The minimum storage size.
+
+        @throws std::length_error `n > max_size()`.
+    */
+    void
+    reserve(std::size_t n)
+    {
+        if(n > max_)
+            detail::throw_length_error();
+        if(n > cap_)
+            reallocate(n);
+    }
+
+    /** Reduce the storage to fit the readable bytes.
+    */
+    void
+    shrink_to_fit()
+    {
+        if(cap_ == in_size_)
+            return;
+        if(in_size_ == 0)
+        {
+            release();
+            data_ = nullptr;
+            cap_ = 0;
+            in_pos_ = 0;
+            out_size_ = 0;
+            return;
+        }
+        reallocate(in_size_);
+    }
+
+    /** Remove all readable bytes.
+    */
+    void
+    clear() noexcept
+    {
+        in_pos_ = 0;
+        in_size_ = 0;
+        out_size_ = 0;
+    }
+
+private:
+    void
+    release() noexcept
+    {
+        if(data_)
+            alloc_traits::deallocate(
+                alloc_, data_, cap_);
+    }
+
+    void
+    compact() noexcept
+    {
+        if(in_size_ > 0)
+            std::memmove(data_,
+                data_ + in_pos_, in_size_);
+        in_pos_ = 0;
+    }
+
+    void
+    reallocate(std::size_t cap)
+    {
+        unsigned char* p =
+            alloc_traits::allocate(alloc_, cap);
+        if(in_size_ > 0)
+            std::memcpy(p,
+                data_ + in_pos_, in_size_);
+        release();
+        data_ = p;
+        cap_ = cap;
+        in_pos_ = 0;
+    }
+
+    void
+    copy_from(
+        basic_growable_flat_buffer const& other)
+    {
+        if(cap_ < other.in_size_)
+        {
+            release();
+            data_ = nullptr;
+            cap_ = 0;
+            reallocate(other.in_size_);
+        }
+        if(other.in_size_ > 0)
+            std::memcpy(data_,
+                other.data_ + other.in_pos_,
+                other.in_size_);
+        in_pos_ = 0;
+        in_size_ = other.in_size_;
+    }
+
+    void
+    copy_assign(
+        basic_growable_flat_buffer const& other,
+        std::true_type)
+    {
+        if(alloc_ != other.alloc_)
+        {
+            // free with the old allocator
+            release();
+            data_ = nullptr;
+            cap_ = 0;
+        }
+        alloc_ = other.alloc_;
+        copy_assign(other, std::false_type{});
+    }
+
+    void
+    copy_assign(
+        basic_growable_flat_buffer const& other,
+        std::false_type)
+    {
+        in_pos_ = 0;
+        in_size_ = 0;
+        out_size_ = 0;
+        max_ = other.max_;
+        copy_from(other);
+    }
+
+    void
+    move_assign(
+        basic_growable_flat_buffer& other,
+        std::true_type) noexcept
+    {
+        release();
+        alloc_ = std::move(other.alloc_);
+        steal(other);
+    }
+
+    void
+    move_assign(
+        basic_growable_flat_buffer& other,
+        std::false_type)
+    {
+        if(alloc_ == other.alloc_)
+        {
+            release();
+            steal(other);
+            return;
+        }
+        in_pos_ = 0;
+        in_size_ = 0;
+        out_size_ = 0;
+        max_ = other.max_;
+        copy_from(other);
+        other.clear();
+    }
+
+    void
+    steal(
+        basic_growable_flat_buffer& other) noexcept
+    {
+        data_ = other.data_;
+        cap_ = other.cap_;
+        in_pos_ = other.in_pos_;
+        in_size_ = other.in_size_;
+        out_size_ = 0;
+        max_ = other.max_;
+        other.data_ = nullptr;
+        other.cap_ = 0;
+        other.in_pos_ = 0;
+        other.in_size_ = 0;
+        other.out_size_ = 0;
+    }
+};
+
+/** A growable flat buffer using the default allocator
+*/
+using growable_flat_buffer =
+    basic_growable_flat_buffer<>;
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,320 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_IOVEC_HPP
+#define BOOST_BUFFERS_IOVEC_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/any_buffers.hpp>
+#include <boost/buffers/buffer.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <boost/core/span.hpp>
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+#include <sys/uio.h>
+
+#ifndef BOOST_BUFFERS_IOV_MAX
+# ifdef IOV_MAX
+#  define BOOST_BUFFERS_IOV_MAX IOV_MAX
+# else
+#  define BOOST_BUFFERS_IOV_MAX 1024
+# endif
+#endif
+
+namespace boost {
+namespace buffers {
+
+/** The largest number of elements in one scatter/gather call.
+
+    This is the value of `IOV_MAX`, the limit on the
+    number of elements passed to `readv`, `writev`,
+    `sendmsg` and `recvmsg`.
+*/
+constexpr std::size_t iov_max = BOOST_BUFFERS_IOV_MAX;
+
+namespace detail {
+
+template<class T>
+struct is_any_buffers : std::false_type
+{
+};
+
+template<bool IsConst, bool IsRandomAccess>
+struct is_any_buffers<any_buffers<IsConst, IsRandomAccess>>
+    : std::true_type
+{
+};
+
+// True if an array of Buffer has the layout of an array of iovec
+template<class Buffer>
+struct is_iovec_compatible : std::integral_constant<bool,
+    (std::is_same<Buffer, const_buffer>::value ||
+        std::is_same<Buffer, mutable_buffer>::value) &&
+    std::is_standard_layout<Buffer>::value &&
+    sizeof(Buffer) == sizeof(::iovec) &&
+    alignof(Buffer) == alignof(::iovec) &&
+    offsetof(::iovec, iov_base) == 0 &&
+    offsetof(::iovec, iov_len) == sizeof(void*)>
+{
+};
+
+} // detail
+
+/** A cursor which presents a buffer sequence as arrays of iovec.
+
+    This visits a buffer sequence in batches of
+    `struct iovec`, for passing to the POSIX
+    scatter/gather functions. Each batch is limited
+    to a caller-supplied number of elements, such
+    as @ref iov_max, and the cursor resumes where the
+    previous batch ended without iterating the
+    sequence from the beginning. Partial transfers
+    are handled by consuming the number of bytes
+    actually transferred:
+
+    @code
+    template<class ConstBufferSequence>
+    void write_all( int fd, ConstBufferSequence const& bs )
+    {
+        iovec v[ iov_max ];
+        iovec_cursor< ConstBufferSequence > c( bs );
+        while( ! c.empty() )
+        {
+            auto const iov = c.prepare( v, iov_max );
+            auto const n = ::writev( fd, iov.data(), iov.size() );
+            if( n < 0 )
+                throw_errno();
+            c.consume( n );
+        }
+    }
+    @endcode
+
+    Zero-length buffers in the sequence are skipped.
+    When the iterators of the sequence are pointers to
+    @ref const_buffer or @ref mutable_buffer, as for a
+    span, and those types have the layout of `iovec`,
+    the batch refers to the elements of the sequence
+    directly and nothing is copied. In this case
+    zero-length buffers are skipped only at the start
+    of a batch, which the system calls accept. A
+    @ref any_buffers is visited with its `fetch`
+    member, costing one indirect call per batch.
+
+    The buffer sequence must remain valid while
+    the cursor is in use.
+
+    @tparam BufferSequence A type meeting the
+    requirements of ConstBufferSequence. For use
+    with `readv` or `recvmsg`, it must also meet
+    the requirements of MutableBufferSequence.
+*/
+template<class BufferSequence>
+class iovec_cursor
+{
+    using iterator = decltype(buffers::begin(
+        std::declval<BufferSequence const&>()));
+    using value_type = typename std::remove_cv<
+        typename std::remove_reference<decltype(
+            *std::declval<iterator>())>::type>::type;
+
+    static constexpr int generic_path = 0;
+    static constexpr int direct_path = 1;
+    static constexpr int any_buffers_path = 2;
+
+    using path = std::integral_constant<int,
+        detail::is_any_buffers<BufferSequence>::value ?
+            any_buffers_path :
+        (std::is_pointer<iterator>::value &&
+            detail::is_iovec_compatible<value_type>::value) ?
+            direct_path : generic_path>;
+
+    BufferSequence const* bs_;
+    iterator it_;
+    iterator end_;
+    std::size_t off_ = 0;
+
+public:
+    /** Constructor.
+
+        @param bs The buffer sequence. Ownership is
+        not transferred, and the sequence must remain
+        valid while the cursor is in use.
+    */
+    explicit
+    iovec_cursor(
+        BufferSequence const& bs)
+        : bs_(&bs)
+        , it_(buffers::begin(bs))
+        , end_(buffers::end(bs))
+    {
+        skip_empty();
+    }
+
+    iovec_cursor(BufferSequence&&) = delete;
+
+    /** Return true if every byte has been consumed.
+    */
+    bool
+    empty() const noexcept
+    {
+        return it_ == end_;
+    }
+
+    /** Return the next batch of buffers.
+
+        The batch starts at the first byte which has
+        not been consumed. Calling this function does
+        not consume any bytes, so calling it again
+        returns the same batch.
+
+        @return A span of at most `n` elements which
+        are not empty. The span is empty only if
+        @ref empty returns `true`. It refers either to
+        `dest` or to the elements of the sequence, and
+        remains valid until the cursor or the sequence
+        is modified or destroyed.
+
+        @param dest A pointer to at least `n` elements,
+        used when the batch must be copied.
+
+        @param n The largest number of elements in the
+        batch, at most @ref iov_max for use with the
+        system calls.
+    */
+    span<::iovec const>
+    prepare(
+        ::iovec* dest,
+        std::size_t n)
+    {
+        return prepare(dest, n, path{});
+    }
+
+    /** Consume bytes from the front of the sequence.
+
+        This is called with the number of bytes
+        transferred by the system call. If `n` is
+        larger than the number of remaining bytes,
+        the cursor becomes empty.
+    */
+    void
+    consume(std::size_t n)
+    {
+        while(it_ != end_)
+        {
+            auto const avail =
+                const_buffer(*it_).size() - off_;
+            if(n < avail)
+            {
+                off_ += n;
+                return;
+            }
+            n -= avail;
+            off_ = 0;
+            ++it_;
+            if(n == 0)
+                break;
+        }
+        skip_empty();
+    }
+
+private:
+    void
+    skip_empty()
+    {
+        while(it_ != end_ &&
+            const_buffer(*it_).size() == 0)
+            ++it_;
+    }
+
+    static
+    void
+    assign(
+        ::iovec& v,
+        const_buffer b) noexcept
+    {
+        v.iov_base = const_cast<void*>(b.data());
+        v.iov_len = b.size();
+    }
+
+    span<::iovec const>
+    prepare(
+        ::iovec* dest,
+        std::size_t n,
+        std::integral_constant<int, generic_path>)
+    {
+        std::size_t i = 0;
+        auto it = it_;
+        auto off = off_;
+        for(; i < n && it != end_; ++it)
+        {
+            const_buffer b(*it);
+            b += off;
+            off = 0;
+            if(b.size() != 0)
+                assign(dest[i++], b);
+        }
+        return { dest, i };
+    }
+
+    span<::iovec const>
+    prepare(
+        ::iovec* dest,
+        std::size_t n,
+        std::integral_constant<int, direct_path>)
+    {
+        if(off_ != 0)
+            return prepare(dest, n, std::integral_constant<
+                int, generic_path>{});
+
+        // only the system call reads the elements
+        // through the iovec type, so this does not
+        // alias them in user code
+        auto const count = static_cast<std::size_t>(end_ - it_);
+        return { reinterpret_cast<::iovec const*>(it_),
+            count < n ? count : n };
+    }
+
+    span<::iovec const>
+    prepare(
+        ::iovec* dest,
+        std::size_t n,
+        std::integral_constant<int, any_buffers_path>)
+    {
+        std::size_t i = 0;
+        auto it = it_;
+        auto off = off_;
+        value_type v[16];
+        while(i < n)
+        {
+            auto const want = n - i < 16 ? n - i : 16;
+            auto const got = bs_->fetch(it, v, want);
+            for(std::size_t j = 0; j < got; ++j)
+            {
+                const_buffer b(v[j]);
+                b += off;
+                off = 0;
+                if(b.size() != 0)
+                    assign(dest[i++], b);
+            }
+            if(got < want)
+                break;
+        }
+        return { dest, i };
+    }
+};
+
+} // buffers
+} // boost
+
+#endif
+
+#endif
@@ -0,0 +1,245 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_MAPPED_FILE_SOURCE_HPP
+#define BOOST_BUFFERS_MAPPED_FILE_SOURCE_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/buffer.hpp>
+#include <cstdint>
+#include <utility>
+
+namespace boost {
+namespace buffers {
+
+/** A data source over a memory-mapped file.
+
+    The contents of a file, or of a range of bytes
+    in a file, are mapped read-only into memory and
+    presented as a single @ref const_buffer. No bytes
+    are copied, and pages are read from the file
+    when they are first accessed. This satisfies
+    @ref is_data_source.
+
+    The mapping remains valid after the file is
+    closed. Bytes appended to the file after the
+    mapping is created are not included, and the
+    behavior is undefined if the file is truncated
+    while it is mapped. Objects are move-only.
+
+    @par Platform
+    The mapping is implemented on POSIX systems
+    using `mmap` and `madvise`. On other platforms
+    the constructors throw.
+*/
+class mapped_file_source
+{
+    void* base_ = nullptr;
+    std::size_t map_size_ = 0;
+    const_buffer data_;
+
+public:
+    /** Hints describing how the bytes will be accessed.
+    */
+    enum class advice
+    {
+        /// No particular access pattern
+        normal,
+
+        /// The bytes will be read in order
+        sequential,
+
+        /// The bytes will be read in no particular order
+        random,
+
+        /// The bytes will be read soon
+        willneed
+    };
+
+    /** Options used when mapping a file.
+    */
+    struct options
+    {
+        /// The access hint applied to the mapping
+        advice hint = advice::normal;
+
+        /** Request transparent huge pages.
+
+            The mapping is placed so that its address
+            and the file offset are aligned alike to
+            the huge page size, which lets the system
+            back it with huge pages where supported.
+        */
+        bool huge_pages = false;
+    };
+
+    /** Destructor.
+    */
+    BOOST_BUFFERS_DECL
+    ~mapped_file_source();
+
+    /** Constructor.
+
+        Default-constructed objects are empty.
+    */
+    mapped_file_source() = default;
+
+    /** Constructor.
+
+        The entire file is mapped.
+
+        @param path The path of the file.
+
+        @throw system::system_error if the file
+        cannot be opened or mapped.
+    */
+    explicit
+    mapped_file_source(
+        char const* path)
+        : mapped_file_source(path, options())
+    {
+    }
+
+    /** Constructor.
+
+        The entire file is mapped.
+
+        @param path The path of the file.
+
+        @param opt The options for the mapping.
+
+        @throw system::system_error if the file
+        cannot be opened or mapped.
+    */
+    mapped_file_source(
+        char const* path,
+        options const& opt)
+        : mapped_file_source(
+            path, 0, std::size_t(-1), opt)
+    {
+    }
+
+    /** Constructor.
+
+        The range of the file starting at `offset`
+        is mapped, as if by calling
+        `mapped_file_source( path, offset, size, options() )`.
+    */
+    mapped_file_source(
+        char const* path,
+        std::uint64_t offset,
+        std::size_t size)
+        : mapped_file_source(
+            path, offset, size, options())
+    {
+    }
+
+    /** Constructor.
+
+        The range of the file starting at `offset` is
+        mapped. The range is clamped to the end of the
+        file, and is empty if `offset` is at or past
+        the end of the file.
+
+        @param path The path of the file.
+
+        @param offset The offset of the first byte.
+        It does not need to be aligned.
+
+        @param size The number of bytes.
+
+        @param opt The options for the mapping.
+
+        @throw system::system_error if the file
+        cannot be opened or mapped.
+
+        @throw std::length_error if the range does
+        not fit in the address space.
+    */
+    BOOST_BUFFERS_DECL
+    mapped_file_source(
+        char const* path,
+        std::uint64_t offset,
+        std::size_t size,
+        options const& opt);
+
+    /** Constructor.
+
+        The new object takes ownership of the mapping,
+        and `other` is left empty.
+    */
+    mapped_file_source(
+        mapped_file_source&& other) noexcept
+        : base_(other.base_)
+        , map_size_(other.map_size_)
+        , data_(other.data_)
+    {
+        other.base_ = nullptr;
+        other.map_size_ = 0;
+        other.data_ = {};
+    }
+
+    /** Assignment.
+
+        The mapping of `*this` is released, and
+        `other` is left empty.
+    */
+    mapped_file_source&
+    operator=(
+        mapped_file_source&& other) noexcept
+    {
+        if(this != &other)
+        {
+            mapped_file_source tmp(std::move(*this));
+            base_ = other.base_;
+            map_size_ = other.map_size_;
+            data_ = other.data_;
+            other.base_ = nullptr;
+            other.map_size_ = 0;
+            other.data_ = {};
+        }
+        return *this;
+    }
+
+    mapped_file_source(
+        mapped_file_source const&) = delete;
+
+    mapped_file_source& operator=(
+        mapped_file_source const&) = delete;
+
+    /** Return the mapped bytes.
+    */
+    const_buffer
+    data() const noexcept
+    {
+        return data_;
+    }
+
+    /** Return the number of mapped bytes.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return data_.size();
+    }
+
+    /** Apply an access hint to the mapping.
+
+        The hint only affects performance, and
+        failures are ignored.
+    */
+    BOOST_BUFFERS_DECL
+    void
+    advise(advice a) const noexcept;
+};
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,257 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_MIRRORED_BUFFER_HPP
+#define BOOST_BUFFERS_MIRRORED_BUFFER_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/buffer.hpp>
+#include <boost/buffers/detail/except.hpp>
+#include <utility>
+
+namespace boost {
+namespace buffers {
+
+/** A circular buffer whose sequences are always contiguous.
+
+    This implements a fixed-size circular buffer
+    whose storage is mapped twice, back to back,
+    in virtual memory. Bytes written past the end
+    of the first mapping appear at the beginning
+    of the storage, so any window of up to
+    @ref max_size bytes is contiguous. Buffer
+    sequences returned from @ref prepare and
+    @ref data always have a single element.
+
+    The capacity is rounded up to a multiple of
+    the page size. Objects are move-only.
+
+    @par Platform
+    The mapping is implemented on Linux using
+    `memfd_create` and `mmap`. On other platforms
+    the allocating constructor throws.
+*/
+class mirrored_buffer
+{
+    unsigned char* base_ = nullptr;
+    std::size_t cap_ = 0;
+    std::size_t in_pos_ = 0;
+    std::size_t in_size_ = 0;
+    std::size_t out_size_ = 0;
+
+public:
+    /** The ConstBufferSequence used to
+        represent the readable bytes.
+    */
+    using const_buffers_type = const_buffer;
+
+    /** The MutableBufferSequence used to
+        represent the writable bytes.
+    */
+    using mutable_buffers_type = mutable_buffer;
+
+    /** Destructor.
+    */
+    BOOST_BUFFERS_DECL
+    ~mirrored_buffer();
+
+    /** Constructor.
+
+        Default constructed objects have
+        zero capacity.
+    */
+    mirrored_buffer() = default;
+
+    /** Constructor.
+
+        @param capacity The minimum capacity. It is
+        rounded up to a multiple of the page size,
+        and is at least one page.
+
+        @throw std::length_error if the capacity
+        cannot be mapped twice in the address space.
+
+        @throw system::system_error if the storage
+        cannot be created or mapped.
+    */
+    BOOST_BUFFERS_DECL
+    explicit
+    mirrored_buffer(std::size_t capacity);
+
+    /** Constructor.
+
+        The new object takes ownership of the storage,
+        and `other` is left with zero capacity.
+    */
+    mirrored_buffer(
+        mirrored_buffer&& other) noexcept
+        : base_(other.base_)
+        , cap_(other.cap_)
+        , in_pos_(other.in_pos_)
+        , in_size_(other.in_size_)
+    {
+        other.base_ = nullptr;
+        other.cap_ = 0;
+        other.in_pos_ = 0;
+        other.in_size_ = 0;
+        other.out_size_ = 0;
+    }
+
+    /** Assignment.
+
+        The storage of `*this` is released, and
+        `other` is left with zero capacity.
+    */
+    mirrored_buffer&
+    operator=(
+        mirrored_buffer&& other) noexcept
+    {
+        if(this != &other)
+        {
+            mirrored_buffer tmp(std::move(*this));
+            base_ = other.base_;
+            cap_ = other.cap_;
+            in_pos_ = other.in_pos_;
+            in_size_ = other.in_size_;
+            out_size_ = 0;
+            other.base_ = nullptr;
+            other.cap_ = 0;
+            other.in_pos_ = 0;
+            other.in_size_ = 0;
+            other.out_size_ = 0;
+        }
+        return *this;
+    }
+
+    mirrored_buffer(
+        mirrored_buffer const&) = delete;
+
+    mirrored_buffer& operator=(
+        mirrored_buffer const&) = delete;
+
+    /** Returns the number of readable bytes.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return in_size_;
+    }
+
+    /** Returns the maximum sum of the input and
+        output sequence sizes.
+    */
+    std::size_t
+    max_size() const noexcept
+    {
+        return cap_;
+    }
+
+    /** Returns the number of writable bytes.
+    */
+    std::size_t
+    capacity() const noexcept
+    {
+        return cap_ - in_size_;
+    }
+
+    /** Returns a constant buffer sequence representing
+        the readable bytes.
+    */
+    const_buffers_type
+    data() const noexcept
+    {
+        return { base_ + in_pos_, in_size_ };
+    }
+
+    /** Returns a mutable buffer sequence representing
+        the writable bytes.
+
+        All buffers sequences previously
+        obtained using @ref prepare become
+        invalid.
+
+        @param n The desired number of bytes in
+        the returned buffer sequence.
+
+        @throw std::length_error if @ref size() + n
+        exceeds @ref max_size().
+    */
+    mutable_buffers_type
+    prepare(std::size_t n)
+    {
+        // Buffer is too small for n
+        if(n > cap_ - in_size_)
+            detail::throw_length_error();
+
+        out_size_ = n;
+        return { base_ + in_pos_ + in_size_, n };
+    }
+
+    /** Append writable bytes to the readable bytes.
+
+        Appends n bytes from the start of the
+        writable bytes to the end of the
+        readable bytes. The remainder of the
+        writable bytes are discarded. If n is
+        greater than the number of writable
+        bytes, all writable bytes are appended
+        to the readable bytes.
+
+        All buffer sequences previously obtained
+        using @ref prepare are invalidated.
+
+        Buffer sequences previously obtained
+        using @ref data remain valid.
+
+        @param n The number of bytes to append. If
+        this number is greater than the number
+        of writable bytes, all writable bytes
+        are appended.
+    */
+    void
+    commit(std::size_t n) noexcept
+    {
+        if(n < out_size_)
+            in_size_ += n;
+        else
+            in_size_ += out_size_;
+        out_size_ = 0;
+    }
+
+    /** Remove bytes from beginning of the readable bytes.
+
+        All buffers sequences previously
+        obtained using @ref data are
+        invalidated.
+
+        Buffer sequences previously obtained
+        using @ref prepare remain valid.
+
+        @param n The number of bytes to remove.
+        If this number is greater than the
+        number of readable bytes, all readable
+        bytes are removed.
+    */
+    void
+    consume(std::size_t n) noexcept
+    {
+        if(n > in_size_)
+            n = in_size_;
+        in_pos_ += n;
+        in_size_ -= n;
+        // stay within the first mapping
+        if(in_pos_ >= cap_)
+            in_pos_ -= cap_;
+    }
+};
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,249 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_POW2_CIRCULAR_BUFFER_HPP
+#define BOOST_BUFFERS_POW2_CIRCULAR_BUFFER_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/buffer_pair.hpp>
+#include <boost/buffers/detail/except.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace buffers {
+
+/** A circular buffer whose capacity is a power of two.
+
+    This behaves like @ref circular_buffer, but
+    requires the capacity to be a power of two.
+    The read and write positions are kept as
+    free-running 64-bit counters and the storage
+    is indexed with a mask, so no operation
+    performs a division. Buffer sequences
+    returned from @ref prepare and @ref data
+    always have length two.
+*/
+class pow2_circular_buffer
+{
+    unsigned char* base_ = nullptr;
+    std::size_t cap_ = 0;
+    std::size_t mask_ = 0;
+    std::uint64_t head_ = 0;
+    std::uint64_t tail_ = 0;
+    std::size_t out_size_ = 0;
+
+public:
+    /** The ConstBufferSequence used to
+        represent the readable bytes.
+    */
+    using const_buffers_type =
+        const_buffer_pair;
+
+    /** The MutableBufferSequence used to
+        represent the writable bytes.
+    */
+    using mutable_buffers_type =
+        mutable_buffer_pair;
+
+    /** Constructor.
+    */
+    pow2_circular_buffer() = default;
+
+    /** Constructor.
+    */
+    pow2_circular_buffer(
+        pow2_circular_buffer const&) = default;
+
+    /** Constructor.
+
+        @throw std::invalid_argument if `capacity`
+        is not zero or a power of two.
+    */
+    pow2_circular_buffer(
+        void* base,
+        std::size_t capacity)
+        : base_(static_cast<
+            unsigned char*>(base))
+        , cap_(capacity)
+        , mask_(capacity - 1)
+    {
+        if((capacity & mask_) != 0)
+            detail::throw_invalid_argument();
+    }
+
+    /** Constructor.
+
+        @throw std::invalid_argument if `capacity`
+        is not zero or a power of two, or if
+        `initial_size > capacity`.
+    */
+    pow2_circular_buffer(
+        void* base,
+        std::size_t capacity,
+        std::size_t initial_size)
+        : pow2_circular_buffer(base, capacity)
+    {
+        if(initial_size > capacity)
+            detail::throw_invalid_argument();
+        tail_ = initial_size;
+    }
+
+    /** Assignment.
+    */
+    pow2_circular_buffer& operator=(
+        pow2_circular_buffer const&) = default;
+
+    /** Returns the number of readable bytes.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return static_cast<
+            std::size_t>(tail_ - head_);
+    }
+
+    /** Returns the maximum sum of the input and
+        output sequence sizes.
+    */
+    std::size_t
+    max_size() const noexcept
+    {
+        return cap_;
+    }
+
+    /** Returns the number of writable bytes.
+    */
+    std::size_t
+    capacity() const noexcept
+    {
+        return cap_ - size();
+    }
+
+    /** Returns a constant buffer sequence representing
+        the readable bytes.
+    */
+    const_buffers_type
+    data() const noexcept
+    {
+        auto const pos = index(head_);
+        auto const n = size();
+        auto const n0 = split(pos, n);
+        return {{
+            const_buffer{ base_ + pos, n0 },
+            const_buffer{ base_, n - n0 } }};
+    }
+
+    /** Returns a mutable buffer sequence representing
+        the writable bytes.
+
+        All buffers sequences previously
+        obtained using @ref prepare become
+        invalid.
+
+        @param n The desired number of bytes in
+        the returned buffer sequence.
+
+        @throw std::length_error if @ref size() + n
+        exceeds @ref max_size().
+    */
+    mutable_buffers_type
+    prepare(std::size_t n)
+    {
+        // Buffer is too small for n
+        if(n > capacity())
+            detail::throw_length_error();
+
+        out_size_ = n;
+        auto const pos = index(tail_);
+        auto const n0 = split(pos, n);
+        return {{
+            mutable_buffer{ base_ + pos, n0 },
+            mutable_buffer{ base_, n - n0 } }};
+    }
+
+    /** Append writable bytes to the readable bytes.
+
+        Appends n bytes from the start of the
+        writable bytes to the end of the
+        readable bytes. The remainder of the
+        writable bytes are discarded. If n is
+        greater than the number of writable
+        bytes, all writable bytes are appended
+        to the readable bytes.
+
+        All buffer sequences previously obtained
+        using @ref prepare are invalidated.
+
+        Buffer sequences previously obtained
+        using @ref data remain valid.
+
+        @param n The number of bytes to append. If
+        this number is greater than the number
+        of writable bytes, all writable bytes
+        are appended.
+    */
+    void
+    commit(std::size_t n) noexcept
+    {
+        tail_ += n < out_size_ ? n : out_size_;
+        out_size_ = 0;
+    }
+
+    /** Remove bytes from beginning of the readable bytes.
+
+        All buffers sequences previously
+        obtained using @ref data are
+        invalidated.
+
+        Buffer sequences previously obtained
+        using @ref prepare remain valid.
+
+        @param n The number of bytes to remove.
+        If this number is greater than the
+        number of readable bytes, all readable
+        bytes are removed.
+    */
+    void
+    consume(std::size_t n) noexcept
+    {
+        auto const len = size();
+        head_ += n < len ? n : len;
+        // make prepare return a bigger single
+        // buffer, unless a prepared buffer
+        // depends on the current position
+        if(head_ == tail_ && out_size_ == 0)
+        {
+            head_ = 0;
+            tail_ = 0;
+        }
+    }
+
+private:
+    std::size_t
+    index(std::uint64_t pos) const noexcept
+    {
+        return static_cast<
+            std::size_t>(pos) & mask_;
+    }
+
+    // bytes of n which fit before the end of storage
+    std::size_t
+    split(
+        std::size_t pos,
+        std::size_t n) const noexcept
+    {
+        auto const room = cap_ - pos;
+        return n < room ? n : room;
+    }
+};
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,601 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_ROPE_HPP
+#define BOOST_BUFFERS_ROPE_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/buffer.hpp>
+#include <boost/buffers/slice.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace boost {
+namespace buffers {
+
+namespace detail {
+
+struct rope_node
+{
+    rope_node* left;
+    rope_node* right;
+    rope_node* parent;
+    std::size_t bytes;
+    const_buffer seg;
+    int height;
+};
+
+} // detail
+
+class rope_slice;
+
+/** A buffer sequence stored as a balanced tree.
+
+    The segments of the sequence are kept in an
+    AVL tree in which each node caches the number
+    of bytes in its subtree. This allows the
+    sequence to be split at any byte offset, and
+    two sequences to be concatenated, in time
+    logarithmic in the number of segments, where
+    a linear sequence such as a vector of buffers
+    takes linear time.
+
+    The rope does not own the memory referenced by
+    its segments. Empty buffers are never stored.
+    Copies of a rope refer to the same memory, and
+    copying takes linear time in the number of
+    segments.
+
+    The functions @ref prefix, @ref suffix,
+    @ref sans_prefix and @ref sans_suffix return a
+    @ref rope_slice, which refers to the tree of the
+    rope without copying it.
+
+    @par Complexity
+    @ref append, @ref split and the in-place slicing
+    operations take time logarithmic in the number
+    of segments, plus time linear in the number of
+    segments which are removed. Forming a
+    @ref rope_slice takes constant time, and
+    iterating the entire sequence takes linear time.
+*/
+class rope
+{
+    detail::rope_node* root_ = nullptr;
+
+    friend class rope_slice;
+
+public:
+    class const_iterator;
+
+    /** The type of each element of the sequence.
+    */
+    using value_type = const_buffer;
+
+    /** Destructor.
+    */
+    BOOST_BUFFERS_DECL
+    ~rope();
+
+    /** Constructor.
+
+        Default-constructed ropes are empty.
+    */
+    rope() = default;
+
+    /** Constructor.
+
+        The new rope refers to the same segments
+        as `other`.
+    */
+    BOOST_BUFFERS_DECL
+    rope(rope const& other);
+
+    /** Constructor.
+
+        Ownership of the tree is transferred from
+        `other`, which becomes empty.
+    */
+    rope(rope&& other) noexcept
+        : root_(other.root_)
+    {
+        other.root_ = nullptr;
+    }
+
+    /** Constructor.
+
+        The rope refers to each buffer of `bs`.
+    */
+    template<
+        class ConstBufferSequence
+        , class = typename std::enable_if<
+            is_const_buffer_sequence<ConstBufferSequence>::value &&
+            ! std::is_same<typename std::decay<ConstBufferSequence>::type,
+                rope>::value>::type
+    >
+    explicit
+    rope(
+        ConstBufferSequence const& bs)
+    {
+        auto const end_ = buffers::end(bs);
+        for(auto it = buffers::begin(bs); it != end_; ++it)
+            append(const_buffer(*it));
+    }
+
+    /** Assignment.
+    */
+    BOOST_BUFFERS_DECL
+    rope&
+    operator=(rope const& other);
+
+    /** Assignment.
+    */
+    rope&
+    operator=(rope&& other) noexcept
+    {
+        rope temp(std::move(other));
+        std::swap(root_, temp.root_);
+        return *this;
+    }
+
+    /** Return true if the rope has no segments.
+    */
+    bool
+    empty() const noexcept
+    {
+        return root_ == nullptr;
+    }
+
+    /** Append a buffer to the end of the rope.
+
+        Empty buffers are ignored.
+    */
+    BOOST_BUFFERS_DECL
+    void
+    append(const_buffer b);
+
+    /** Append the segments of another rope.
+
+        After the call `other` is empty.
+
+        @par Complexity
+        Logarithmic in the number of segments.
+    */
+    BOOST_BUFFERS_DECL
+    void
+    append(rope&& other) noexcept;
+
+    /** Split the rope at a byte offset.
+
+        After the call, this rope holds the first
+        `n` bytes, and the returned rope holds the
+        remaining bytes. If `n` falls inside a
+        segment, the segment is divided.
+
+        @par Complexity
+        Logarithmic in the number of segments.
+
+        @param n The byte offset.
+    */
+    BOOST_BUFFERS_DECL
+    rope
+    split(std::size_t n);
+
+    /** Remove all segments.
+    */
+    BOOST_BUFFERS_DECL
+    void
+    clear() noexcept;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    /** Remove a slice from the rope.
+    */
+    friend
+    void
+    tag_invoke(
+        slice_tag const&,
+        rope& r,
+        slice_how how,
+        std::size_t n)
+    {
+        r.do_slice(how, n);
+    }
+
+    friend
+    std::size_t
+    tag_invoke(
+        size_tag const&,
+        rope const& r) noexcept
+    {
+        return r.root_ ? r.root_->bytes : 0;
+    }
+
+private:
+    BOOST_BUFFERS_DECL
+    void
+    do_slice(
+        slice_how how,
+        std::size_t n);
+};
+
+template<>
+struct has_suffix_slice<rope>
+    : std::true_type
+{
+};
+
+//------------------------------------------------
+
+/** The iterator type of @ref rope.
+*/
+class rope::const_iterator
+{
+    detail::rope_node const* root_ = nullptr;
+    detail::rope_node const* n_ = nullptr;
+
+    friend class rope;
+    friend class rope_slice;
+
+    const_iterator(
+        detail::rope_node const* root,
+        detail::rope_node const* n) noexcept
+        : root_(root)
+        , n_(n)
+    {
+    }
+
+public:
+    using value_type = const_buffer;
+    using reference = const_buffer;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::bidirectional_iterator_tag;
+
+    const_iterator() = default;
+
+    bool
+    operator==(
+        const_iterator const& other) const noexcept
+    {
+        return n_ == other.n_;
+    }
+
+    bool
+    operator!=(
+        const_iterator const& other) const noexcept
+    {
+        return n_ != other.n_;
+    }
+
+    reference
+    operator*() const noexcept
+    {
+        return n_->seg;
+    }
+
+    const_iterator&
+    operator++() noexcept
+    {
+        if(n_->right)
+        {
+            n_ = n_->right;
+            while(n_->left)
+                n_ = n_->left;
+            return *this;
+        }
+        auto p = n_->parent;
+        while(p && n_ == p->right)
+        {
+            n_ = p;
+            p = p->parent;
+        }
+        n_ = p;
+        return *this;
+    }
+
+    const_iterator
+    operator++(int) noexcept
+    {
+        auto temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    const_iterator&
+    operator--() noexcept
+    {
+        if(! n_)
+        {
+            n_ = root_;
+            while(n_->right)
+                n_ = n_->right;
+            return *this;
+        }
+        if(n_->left)
+        {
+            n_ = n_->left;
+            while(n_->right)
+                n_ = n_->right;
+            return *this;
+        }
+        auto p = n_->parent;
+        while(p && n_ == p->left)
+        {
+            n_ = p;
+            p = p->parent;
+        }
+        n_ = p;
+        return *this;
+    }
+
+    const_iterator
+    operator--(int) noexcept
+    {
+        auto temp = *this;
+        --(*this);
+        return temp;
+    }
+};
+
+inline
+auto
+rope::
+begin() const noexcept ->
+    const_iterator
+{
+    auto n = root_;
+    if(n)
+        while(n->left)
+            n = n->left;
+    return const_iterator(root_, n);
+}
+
+inline
+auto
+rope::
+end() const noexcept ->
+    const_iterator
+{
+    return const_iterator(root_, nullptr);
+}
+
+//------------------------------------------------
+
+/** A slice of a rope
+
+    This is the type returned by @ref prefix,
+    @ref suffix, @ref sans_prefix and @ref sans_suffix
+    for a @ref rope. It refers to the tree of the rope
+    and records the range of bytes it represents, so
+    forming, copying and trimming a slice take
+    constant time and do not allocate. Finding the
+    first and last segments when iterating takes time
+    logarithmic in the number of segments.
+
+    The rope must not be modified or destroyed
+    while a slice refers to it.
+*/
+class rope_slice
+{
+    detail::rope_node const* root_ = nullptr;
+    std::size_t pos_ = 0;   // offset of the first byte
+    std::size_t size_ = 0;  // number of bytes
+
+public:
+    class const_iterator;
+
+    /** The type of each element of the sequence.
+    */
+    using value_type = const_buffer;
+
+    /** Constructor
+
+        Default-constructed slices are empty.
+    */
+    rope_slice() = default;
+
+    /** Constructor
+
+        The slice refers to all of the bytes
+        of `r`.
+    */
+    rope_slice(
+        rope const& r) noexcept
+        : root_(r.root_)
+        , size_(r.root_ ? r.root_->bytes : 0)
+    {
+    }
+
+    /** Return an iterator to the beginning of the sequence
+
+        Iterators refer to this object and are
+        invalidated when it is modified.
+    */
+    BOOST_BUFFERS_DECL
+    const_iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end of the sequence
+    */
+    BOOST_BUFFERS_DECL
+    const_iterator
+    end() const noexcept;
+
+    friend
+    void
+    tag_invoke(
+        slice_tag const&,
+        rope_slice& bs,
+        slice_how how,
+        std::size_t n) noexcept
+    {
+        bs.slice_impl(how, n);
+    }
+
+    friend
+    std::size_t
+    tag_invoke(
+        size_tag const&,
+        rope_slice const& bs) noexcept
+    {
+        return bs.size_;
+    }
+
+private:
+    void
+    slice_impl(
+        slice_how how,
+        std::size_t n) noexcept
+    {
+        if(n > size_)
+            n = size_;
+        switch(how)
+        {
+        case slice_how::remove_prefix:
+            pos_ += n;
+            size_ -= n;
+            break;
+
+        case slice_how::keep_prefix:
+            size_ = n;
+            break;
+
+        case slice_how::remove_suffix:
+            size_ -= n;
+            break;
+
+        case slice_how::keep_suffix:
+            pos_ += size_ - n;
+            size_ = n;
+            break;
+        }
+    }
+
+    const_iterator
+    seek(std::size_t n) const noexcept;
+};
+
+template<>
+struct has_suffix_slice<rope_slice>
+    : std::true_type
+{
+};
+
+namespace detail {
+
+template<>
+struct slice_type_impl<rope>
+{
+    using type = rope_slice;
+};
+
+} // detail
+
+//------------------------------------------------
+
+/** The iterator type of @ref rope_slice.
+*/
+class rope_slice::const_iterator
+{
+    rope::const_iterator it_;
+    std::size_t off_ = 0; // offset of *it_ in the rope
+    rope_slice const* s_ = nullptr;
+
+    friend class rope_slice;
+
+    const_iterator(
+        rope::const_iterator it,
+        std::size_t off,
+        rope_slice const* s) noexcept
+        : it_(it)
+        , off_(off)
+        , s_(s)
+    {
+    }
+
+public:
+    using value_type = const_buffer;
+    using reference = const_buffer;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::bidirectional_iterator_tag;
+
+    const_iterator() = default;
+
+    bool
+    operator==(
+        const_iterator const& other) const noexcept
+    {
+        return it_ == other.it_;
+    }
+
+    bool
+    operator!=(
+        const_iterator const& other) const noexcept
+    {
+        return it_ != other.it_;
+    }
+
+    reference
+    operator*() const noexcept
+    {
+        // trim the segment to the slice
+        const_buffer const b = *it_;
+        auto const first = (std::max)(
+            off_, s_->pos_);
+        auto const last = (std::min)(
+            off_ + b.size(), s_->pos_ + s_->size_);
+        return const_buffer(static_cast<
+            unsigned char const*>(b.data()) +
+                (first - off_), last - first);
+    }
+
+    const_iterator&
+    operator++() noexcept
+    {
+        off_ += (*it_).size();
+        ++it_;
+        return *this;
+    }
+
+    const_iterator
+    operator++(int) noexcept
+    {
+        auto temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    const_iterator&
+    operator--() noexcept
+    {
+        --it_;
+        off_ -= (*it_).size();
+        return *this;
+    }
+
+    const_iterator
+    operator--(int) noexcept
+    {
+        auto temp = *this;
+        --(*this);
+        return temp;
+    }
+};
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,818 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_SEGMENTED_BUFFER_HPP
+#define BOOST_BUFFERS_SEGMENTED_BUFFER_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/buffer.hpp>
+#include <boost/buffers/copy.hpp>
+#include <boost/buffers/detail/except.hpp>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace boost {
+namespace buffers {
+
+/** A DynamicBuffer which owns a chain of fixed-size blocks.
+
+    The storage is a doubly linked chain of blocks,
+    each holding the same number of bytes. Growing
+    the buffer appends blocks to the chain, so bytes
+    already in the buffer are never moved or copied.
+    Blocks which are fully consumed are removed from
+    the front of the chain and kept for reuse by a
+    later @ref prepare, until @ref shrink_to_fit
+    returns them to the allocator.
+
+    Buffer sequences returned by @ref data and
+    @ref prepare are lightweight views whose
+    bidirectional iterators walk the chain. They
+    remain valid until the blocks they refer to
+    are consumed.
+
+    @tparam Allocator The allocator used for the blocks.
+*/
+template<class Allocator = std::allocator<unsigned char>>
+class basic_segmented_buffer
+{
+    // Header of each block. The bytes
+    // of the block follow the header.
+    struct block
+    {
+        block* prev;
+        block* next;
+    };
+
+    using alloc_type = typename
+        std::allocator_traits<Allocator>::
+            template rebind_alloc<block>;
+
+    using alloc_traits =
+        std::allocator_traits<alloc_type>;
+
+    alloc_type alloc_;
+    block* head_ = nullptr;     // first block of the chain
+    block* tail_ = nullptr;     // last block of the chain
+    block* out_ = nullptr;      // block of the write position
+    block* free_ = nullptr;     // blocks kept for reuse
+    std::size_t block_size_;
+    std::size_t max_;
+    std::size_t chain_ = 0;     // blocks in the chain
+    std::size_t spare_ = 0;     // blocks in the free list
+    std::size_t in_pos_ = 0;    // offset of readable bytes in head_
+    std::size_t in_size_ = 0;
+    std::size_t out_pos_ = 0;   // offset of write position in out_
+    std::size_t out_size_ = 0;
+
+    template<class Buffer>
+    class buffers_type;
+
+public:
+    using allocator_type = Allocator;
+
+    /** The ConstBufferSequence used to
+        represent the readable bytes.
+    */
+    using const_buffers_type =
+        buffers_type<const_buffer>;
+
+    /** The MutableBufferSequence used to
+        represent the writable bytes.
+    */
+    using mutable_buffers_type =
+        buffers_type<mutable_buffer>;
+
+    /** The block size used when none is specified.
+    */
+    static constexpr std::size_t default_block_size = 4096;
+
+    /** Destructor.
+    */
+    ~basic_segmented_buffer()
+    {
+        release();
+    }
+
+    /** Constructor.
+
+        Default constructed objects have zero
+        capacity and use @ref default_block_size.
+    */
+    basic_segmented_buffer() noexcept(
+        std::is_nothrow_default_constructible<alloc_type>::value)
+        : alloc_()
+        , block_size_(default_block_size)
+        , max_(std::size_t(-1))
+    {
+    }
+
+    /** Constructor.
+
+        @param alloc The allocator to use.
+    */
+    explicit
+    basic_segmented_buffer(
+        Allocator const& alloc) noexcept
+        : alloc_(alloc)
+        , block_size_(default_block_size)
+        , max_(std::size_t(-1))
+    {
+    }
+
+    /** Constructor.
+
+        @param block_size The number of bytes in each block.
+        @param alloc The allocator to use.
+
+        @throw std::invalid_argument `block_size == 0`.
+    */
+    explicit
+    basic_segmented_buffer(
+        std::size_t block_size,
+        Allocator const& alloc = Allocator())
+        : basic_segmented_buffer(
+            block_size, std::size_t(-1), alloc)
+    {
+    }
+
+    /** Constructor.
+
+        @param block_size The number of bytes in each block.
+        @param max_size The upper limit on the number
+            of readable bytes.
+        @param alloc The allocator to use.
+
+        @throw std::invalid_argument `block_size == 0`.
+    */
+    basic_segmented_buffer(
+        std::size_t block_size,
+        std::size_t max_size,
+        Allocator const& alloc = Allocator())
+        : alloc_(alloc)
+        , block_size_(block_size)
+        , max_(max_size)
+    {
+        if(block_size_ == 0)
+            detail::throw_invalid_argument();
+    }
+
+    /** Constructor.
+
+        The new object takes ownership of the blocks,
+        and `other` is left with zero capacity.
+    */
+    basic_segmented_buffer(
+        basic_segmented_buffer&& other) noexcept
+        : alloc_(std::move(other.alloc_))
+        , block_size_(other.block_size_)
+        , max_(other.max_)
+    {
+        steal(other);
+    }
+
+    /** Constructor.
+
+        The new object holds a copy of the readable
+        bytes, using the same block size.
+    */
+    basic_segmented_buffer(
+        basic_segmented_buffer const& other)
+        : alloc_(alloc_traits::
+            select_on_container_copy_construction(
+                other.alloc_))
+        , block_size_(other.block_size_)
+        , max_(other.max_)
+    {
+        copy_from(other);
+    }
+
+    /** Assignment.
+    */
+    basic_segmented_buffer&
+    operator=(
+        basic_segmented_buffer&& other) noexcept(
+            alloc_traits::propagate_on_container_move_assignment::value)
+    {
+        if(this != &other)
+            move_assign(other, typename alloc_traits::
+                propagate_on_container_move_assignment{});
+        return *this;
+    }
+
+    /** Assignment.
+
+        The block size of `other` is not copied.
+    */
+    basic_segmented_buffer&
+    operator=(
+        basic_segmented_buffer const& other)
+    {
+        if(this != &other)
+            copy_assign(other, typename alloc_traits::
+                propagate_on_container_copy_assignment{});
+        return *this;
+    }
+
+    /** Return a copy of the allocator.
+    */
+    allocator_type
+    get_allocator() const noexcept
+    {
+        return allocator_type(alloc_);
+    }
+
+    /** Return the number of bytes in each block.
+    */
+    std::size_t
+    block_size() const noexcept
+    {
+        return block_size_;
+    }
+
+    /** Return the number of readable bytes.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return in_size_;
+    }
+
+    /** Return the maximum number of readable bytes.
+    */
+    std::size_t
+    max_size() const noexcept
+    {
+        return max_;
+    }
+
+    /** Return the number of writable bytes without allocating.
+    */
+    std::size_t
+    capacity() const noexcept
+    {
+        return (chain_ + spare_) * block_size_ -
+            (in_pos_ + in_size_);
+    }
+
+    /** Return a constant buffer sequence representing the readable bytes.
+    */
+    const_buffers_type
+    data() const noexcept
+    {
+        if(in_size_ == 0)
+            return {};
+        return const_buffers_type(
+            head_,
+            out_pos_ == 0 ? out_->prev : out_,
+            in_pos_, in_size_, block_size_);
+    }
+
+    /** Return a mutable buffer sequence representing the writable bytes.
+
+        Blocks are appended to the chain as needed.
+        Buffer sequences previously obtained using
+        @ref data remain valid.
+
+        @param n The desired number of bytes in the
+        returned buffer sequence.
+
+        @throws std::length_error `size() + n > max_size()`.
+    */
+    mutable_buffers_type
+    prepare(std::size_t n)
+    {
+        if(n > max_ - in_size_)
+            detail::throw_length_error();
+        out_size_ = 0;
+        if(n == 0)
+            return {};
+
+        // grow the chain
+        auto avail = chain_ * block_size_ -
+            (in_pos_ + in_size_);
+        while(avail < n)
+        {
+            append(acquire());
+            avail += block_size_;
+        }
+        if(out_ == nullptr)
+        {
+            out_ = head_;
+            out_pos_ = 0;
+        }
+        else if(out_pos_ == block_size_)
+        {
+            out_ = out_->next;
+            out_pos_ = 0;
+        }
+
+        auto last = out_;
+        for(auto i = (out_pos_ + n - 1) / block_size_;
+                i > 0; --i)
+            last = last->next;
+        out_size_ = n;
+        return mutable_buffers_type(
+            out_, last, out_pos_, n, block_size_);
+    }
+
+    /** Commit bytes to the input sequence.
+
+        @param n The number of bytes to commit.
+    */
+    void
+    commit(
+        std::size_t n) noexcept
+    {
+        if(n > out_size_)
+            n = out_size_;
+        out_size_ = 0;
+        in_size_ += n;
+        while(n > 0)
+        {
+            auto const room = block_size_ - out_pos_;
+            if(n < room)
+            {
+                out_pos_ += n;
+                break;
+            }
+            n -= room;
+            out_pos_ = block_size_;
+            if(out_->next)
+            {
+                out_ = out_->next;
+                out_pos_ = 0;
+            }
+        }
+    }
+
+    /** Consume bytes from the input sequence.
+
+        Blocks which no longer hold readable bytes
+        are kept for reuse. Buffer sequences
+        previously obtained using @ref prepare
+        remain valid.
+
+        @param n The number of bytes to consume.
+    */
+    void
+    consume(
+        std::size_t n) noexcept
+    {
+        if(n < in_size_)
+        {
+            in_pos_ += n;
+            in_size_ -= n;
+            while(in_pos_ >= block_size_)
+            {
+                recycle_head();
+                in_pos_ -= block_size_;
+            }
+            return;
+        }
+        in_size_ = 0;
+        if(out_ == nullptr)
+            return;
+        while(head_ != out_)
+            recycle_head();
+        if(out_size_ == 0)
+        {
+            // nothing depends on the position,
+            // so reuse the whole block
+            out_pos_ = 0;
+        }
+        in_pos_ = out_pos_;
+    }
+
+    /** Return unused blocks to the allocator.
+
+        Blocks after the readable bytes, including
+        those kept for reuse, are deallocated.
+        Buffer sequences previously obtained using
+        @ref prepare are invalidated.
+    */
+    void
+    shrink_to_fit() noexcept
+    {
+        out_size_ = 0;
+        while(free_)
+        {
+            auto const b = free_;
+            free_ = b->next;
+            deallocate(b);
+        }
+        spare_ = 0;
+        if(in_size_ == 0)
+        {
+            in_pos_ = 0;
+            out_pos_ = 0;
+            out_ = nullptr;
+            while(head_)
+                pop_tail();
+            return;
+        }
+        auto const last = out_pos_ == 0 ?
+            out_->prev : out_;
+        while(tail_ != last)
+            pop_tail();
+        if(out_pos_ == 0)
+        {
+            out_ = last;
+            out_pos_ = block_size_;
+        }
+    }
+
+    /** Remove all readable bytes.
+
+        The blocks are kept for reuse.
+    */
+    void
+    clear() noexcept
+    {
+        out_size_ = 0;
+        consume(in_size_);
+    }
+
+private:
+    static
+    std::size_t
+    units(std::size_t block_size) noexcept
+    {
+        return 1 + (block_size + sizeof(block) - 1) /
+            sizeof(block);
+    }
+
+    static
+    unsigned char*
+    bytes(block* b) noexcept
+    {
+        return reinterpret_cast<unsigned char*>(b + 1);
+    }
+
+    // Return a block from the free list, or
+    // allocate a new one
+    block*
+    acquire()
+    {
+        if(free_)
+        {
+            auto const b = free_;
+            free_ = b->next;
+            --spare_;
+            return b;
+        }
+        return alloc_traits::allocate(
+            alloc_, units(block_size_));
+    }
+
+    void
+    deallocate(block* b) noexcept
+    {
+        alloc_traits::deallocate(
+            alloc_, b, units(block_size_));
+    }
+
+    void
+    append(block* b) noexcept
+    {
+        b->prev = tail_;
+        b->next = nullptr;
+        if(tail_)
+            tail_->next = b;
+        else
+            head_ = b;
+        tail_ = b;
+        ++chain_;
+    }
+
+    void
+    pop_tail() noexcept
+    {
+        auto const b = tail_;
+        tail_ = b->prev;
+        if(tail_)
+            tail_->next = nullptr;
+        else
+            head_ = nullptr;
+        --chain_;
+        deallocate(b);
+    }
+
+    void
+    recycle_head() noexcept
+    {
+        auto const b = head_;
+        head_ = b->next;
+        if(head_)
+            head_->prev = nullptr;
+        else
+            tail_ = nullptr;
+        --chain_;
+        b->next = free_;
+        free_ = b;
+        ++spare_;
+    }
+
+    void
+    release() noexcept
+    {
+        while(free_)
+        {
+            auto const b = free_;
+            free_ = b->next;
+            deallocate(b);
+        }
+        while(head_)
+        {
+            auto const b = head_;
+            head_ = b->next;
+            deallocate(b);
+        }
+        tail_ = nullptr;
+        out_ = nullptr;
+        chain_ = 0;
+        spare_ = 0;
+        in_pos_ = 0;
+        in_size_ = 0;
+        out_pos_ = 0;
+        out_size_ = 0;
+    }
+
+    void
+    copy_from(
+        basic_segmented_buffer const& other)
+    {
+        commit(buffers::copy(
+            prepare(other.in_size_),
+            other.data()));
+    }
+
+    void
+    copy_assign(
+        basic_segmented_buffer const& other,
+        std::true_type)
+    {
+        if(alloc_ != other.alloc_)
+            release();
+        alloc_ = other.alloc_;
+        copy_assign(other, std::false_type{});
+    }
+
+    void
+    copy_assign(
+        basic_segmented_buffer const& other,
+        std::false_type)
+    {
+        clear();
+        max_ = other.max_;
+        copy_from(other);
+    }
+
+    void
+    move_assign(
+        basic_segmented_buffer& other,
+        std::true_type) noexcept
+    {
+        release();
+        alloc_ = std::move(other.alloc_);
+        block_size_ = other.block_size_;
+        max_ = other.max_;
+        steal(other);
+    }
+
+    void
+    move_assign(
+        basic_segmented_buffer& other,
+        std::false_type)
+    {
+        if(alloc_ == other.alloc_)
+        {
+            release();
+            block_size_ = other.block_size_;
+            max_ = other.max_;
+            steal(other);
+            return;
+        }
+        clear();
+        max_ = other.max_;
+        copy_from(other);
+        other.clear();
+    }
+
+    void
+    steal(
+        basic_segmented_buffer& other) noexcept
+    {
+        head_ = other.head_;
+        tail_ = other.tail_;
+        out_ = other.out_;
+        free_ = other.free_;
+        chain_ = other.chain_;
+        spare_ = other.spare_;
+        in_pos_ = other.in_pos_;
+        in_size_ = other.in_size_;
+        out_pos_ = other.out_pos_;
+        out_size_ = 0;
+        other.head_ = nullptr;
+        other.tail_ = nullptr;
+        other.out_ = nullptr;
+        other.free_ = nullptr;
+        other.chain_ = 0;
+        other.spare_ = 0;
+        other.in_pos_ = 0;
+        other.in_size_ = 0;
+        other.out_pos_ = 0;
+        other.out_size_ = 0;
+    }
+};
+
+template<class Allocator>
+constexpr std::size_t
+basic_segmented_buffer<Allocator>::default_block_size;
+
+//------------------------------------------------
+
+/** A buffer sequence referring to bytes in a chain of blocks.
+*/
+template<class Allocator>
+template<class Buffer>
+class basic_segmented_buffer<Allocator>::buffers_type
+{
+    block* first_ = nullptr;
+    block* last_ = nullptr;
+    std::size_t pos_ = 0;   // offset in the first block
+    std::size_t n_ = 0;
+    std::size_t bs_ = 0;
+
+    friend class basic_segmented_buffer;
+
+    buffers_type(
+        block* first,
+        block* last,
+        std::size_t pos,
+        std::size_t n,
+        std::size_t bs) noexcept
+        : first_(first)
+        , last_(last)
+        , pos_(pos)
+        , n_(n)
+        , bs_(bs)
+    {
+    }
+
+    // number of blocks in the sequence
+    std::size_t
+    count() const noexcept
+    {
+        if(n_ == 0)
+            return 0;
+        return (pos_ + n_ + bs_ - 1) / bs_;
+    }
+
+public:
+    class const_iterator
+    {
+        block* b_ = nullptr;
+        std::size_t i_ = 0;
+        std::size_t count_ = 0;
+        std::size_t pos_ = 0;
+        std::size_t n_ = 0;
+        std::size_t bs_ = 0;
+
+        friend class buffers_type;
+
+        const_iterator(
+            block* b,
+            std::size_t i,
+            buffers_type const& bs) noexcept
+            : b_(b)
+            , i_(i)
+            , count_(bs.count())
+            , pos_(bs.pos_)
+            , n_(bs.n_)
+            , bs_(bs.bs_)
+        {
+        }
+
+    public:
+        using value_type = Buffer;
+        using reference = Buffer;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category =
+            std::bidirectional_iterator_tag;
+
+        const_iterator() = default;
+
+        bool
+        operator==(
+            const_iterator const& other) const noexcept
+        {
+            return
+                b_ == other.b_ &&
+                i_ == other.i_;
+        }
+
+        bool
+        operator!=(
+            const_iterator const& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        reference
+        operator*() const noexcept
+        {
+            std::size_t const first =
+                i_ == 0 ? pos_ : 0;
+            std::size_t last =
+                pos_ + n_ - i_ * bs_;
+            if(last > bs_)
+                last = bs_;
+            return Buffer(
+                bytes(b_) + first,
+                last - first);
+        }
+
+        const_iterator&
+        operator++() noexcept
+        {
+            // the end iterator stays on the last block
+            if(++i_ < count_)
+                b_ = b_->next;
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) noexcept
+        {
+            auto temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        const_iterator&
+        operator--() noexcept
+        {
+            if(i_-- < count_)
+                b_ = b_->prev;
+            return *this;
+        }
+
+        const_iterator
+        operator--(int) noexcept
+        {
+            auto temp = *this;
+            --(*this);
+            return temp;
+        }
+    };
+
+    /** Constructor.
+
+        Default constructed sequences are empty.
+    */
+    buffers_type() = default;
+
+    /** Return an iterator to the beginning of the sequence
+    */
+    const_iterator
+    begin() const noexcept
+    {
+        return const_iterator(first_, 0, *this);
+    }
+
+    /** Return an iterator to the end of the sequence
+    */
+    const_iterator
+    end() const noexcept
+    {
+        return const_iterator(last_, count(), *this);
+    }
+
+    friend
+    std::size_t
+    tag_invoke(
+        size_tag const&,
+        buffers_type const& bs) noexcept
+    {
+        return bs.n_;
+    }
+};
+
+/** A segmented buffer using the default allocator
+*/
+using segmented_buffer =
+    basic_segmented_buffer<>;
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,634 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_SHARED_BUFFER_HPP
+#define BOOST_BUFFERS_SHARED_BUFFER_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/buffer.hpp>
+#include <boost/buffers/copy.hpp>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace buffers {
+
+/** A reference-counted, immutable block of bytes.
+
+    The bytes are copied into a single allocation
+    when the block is created and are never
+    modified afterwards. Copies of the block share
+    the allocation, which is released when the last
+    copy is destroyed. Copies may be used and
+    destroyed concurrently from different threads.
+
+    @see shared_buffer, shared_buffers
+*/
+class shared_block
+{
+    struct header
+    {
+        std::atomic<std::size_t> refs;
+        std::size_t size;
+    };
+
+    header* h_ = nullptr;
+
+    void
+    release() noexcept
+    {
+        if(h_ && h_->refs.fetch_sub(1,
+            std::memory_order_acq_rel) == 1)
+        {
+            h_->~header();
+            ::operator delete(h_);
+        }
+    }
+
+public:
+    /** Destructor.
+    */
+    ~shared_block()
+    {
+        release();
+    }
+
+    /** Constructor.
+
+        Default-constructed blocks are empty.
+    */
+    shared_block() = default;
+
+    /** Constructor.
+
+        The new block shares ownership with `other`.
+    */
+    shared_block(
+        shared_block const& other) noexcept
+        : h_(other.h_)
+    {
+        if(h_)
+            h_->refs.fetch_add(1,
+                std::memory_order_relaxed);
+    }
+
+    /** Constructor.
+
+        Ownership is transferred from `other`,
+        which becomes empty.
+    */
+    shared_block(
+        shared_block&& other) noexcept
+        : h_(other.h_)
+    {
+        other.h_ = nullptr;
+    }
+
+    /** Constructor.
+
+        A new block is allocated and the bytes of
+        `bs` are copied into it.
+
+        @param bs The bytes to copy.
+
+        @throw std::bad_alloc if the allocation fails.
+    */
+    template<
+        class ConstBufferSequence
+        , class = typename std::enable_if<
+            is_const_buffer_sequence<ConstBufferSequence>::value &&
+            ! std::is_same<typename std::decay<ConstBufferSequence>::type,
+                shared_block>::value>::type
+    >
+    explicit
+    shared_block(
+        ConstBufferSequence const& bs)
+    {
+        auto const n = buffers::size(bs);
+        h_ = ::new(::operator new(
+            sizeof(header) + n)) header{ {1}, n };
+        buffers::copy(
+            mutable_buffer(h_ + 1, n), bs);
+    }
+
+    /** Assignment.
+    */
+    shared_block&
+    operator=(
+        shared_block const& other) noexcept
+    {
+        shared_block(other).swap(*this);
+        return *this;
+    }
+
+    /** Assignment.
+    */
+    shared_block&
+    operator=(
+        shared_block&& other) noexcept
+    {
+        shared_block(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    /** Return a pointer to the bytes.
+    */
+    void const*
+    data() const noexcept
+    {
+        return h_ ? static_cast<
+            void const*>(h_ + 1) : nullptr;
+    }
+
+    /** Return the number of bytes.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return h_ ? h_->size : 0;
+    }
+
+    /** Return the number of blocks sharing the bytes.
+
+        The value is zero for an empty block.
+    */
+    std::size_t
+    use_count() const noexcept
+    {
+        return h_ ? h_->refs.load(
+            std::memory_order_relaxed) : 0;
+    }
+
+    /** Exchange the contents with another block.
+    */
+    void
+    swap(shared_block& other) noexcept
+    {
+        std::swap(h_, other.h_);
+    }
+
+    /** Exchange the contents of two blocks.
+    */
+    friend
+    void
+    swap(
+        shared_block& b0,
+        shared_block& b1) noexcept
+    {
+        b0.swap(b1);
+    }
+};
+
+//------------------------------------------------
+
+/** A buffer referring to a range of bytes in a shared block.
+
+    The buffer keeps the block alive. Copying the
+    buffer does not copy the bytes, it only
+    increments the reference count of the block.
+    The type is a ConstBufferSequence of length
+    one, so it may be passed directly to the
+    algorithms of the library and to Asio.
+
+    @see shared_block, shared_buffers
+*/
+class shared_buffer
+{
+    shared_block block_;
+    const_buffer b_;
+
+public:
+    /** The type of each element of the sequence.
+    */
+    using value_type = const_buffer;
+
+    /** The type of iterator.
+    */
+    using const_iterator = const_buffer const*;
+
+    /** Constructor.
+
+        Default-constructed buffers are empty.
+    */
+    shared_buffer() = default;
+
+    /** Constructor.
+
+        The buffer refers to all the bytes of
+        the block.
+    */
+    explicit
+    shared_buffer(
+        shared_block block) noexcept
+        : block_(std::move(block))
+        , b_(block_.data(), block_.size())
+    {
+    }
+
+    /** Constructor.
+
+        The buffer refers to a range of the bytes
+        of the block. The range is clamped to the
+        size of the block.
+
+        @param block The block.
+
+        @param pos The offset of the first byte.
+
+        @param n The number of bytes.
+    */
+    shared_buffer(
+        shared_block block,
+        std::size_t pos,
+        std::size_t n) noexcept
+        : shared_buffer(std::move(block))
+    {
+        b_ += pos;
+        if(n < b_.size())
+            b_ = const_buffer(b_.data(), n);
+    }
+
+    /** Constructor.
+
+        A new block is allocated and the bytes of
+        `bs` are copied into it.
+
+        @throw std::bad_alloc if the allocation fails.
+    */
+    template<
+        class ConstBufferSequence
+        , class = typename std::enable_if<
+            is_const_buffer_sequence<ConstBufferSequence>::value &&
+            ! std::is_same<typename std::decay<ConstBufferSequence>::type,
+                shared_buffer>::value>::type
+    >
+    explicit
+    shared_buffer(
+        ConstBufferSequence const& bs)
+        : shared_buffer(shared_block(bs))
+    {
+    }
+
+    /** Return the block.
+    */
+    shared_block const&
+    block() const noexcept
+    {
+        return block_;
+    }
+
+    /** Return a pointer to the first byte.
+    */
+    void const*
+    data() const noexcept
+    {
+        return b_.data();
+    }
+
+    /** Return the number of bytes.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return b_.size();
+    }
+
+    /** Return an iterator to the beginning.
+    */
+    const_iterator
+    begin() const noexcept
+    {
+        return &b_;
+    }
+
+    /** Return an iterator to the end.
+    */
+    const_iterator
+    end() const noexcept
+    {
+        return &b_ + 1;
+    }
+
+    /** Remove a slice from the buffer.
+
+        The buffer continues to hold the
+        whole block.
+    */
+    friend
+    void
+    tag_invoke(
+        slice_tag const&,
+        shared_buffer& b,
+        slice_how how,
+        std::size_t n) noexcept
+    {
+        tag_invoke(slice_tag{}, b.b_, how, n);
+    }
+
+    friend
+    std::size_t
+    tag_invoke(
+        size_tag const&,
+        shared_buffer const& b) noexcept
+    {
+        return b.b_.size();
+    }
+};
+
+template<>
+struct has_suffix_slice<shared_buffer>
+    : std::true_type
+{
+};
+
+//------------------------------------------------
+
+/** A sequence of shared buffers.
+
+    This ConstBufferSequence holds a list of
+    @ref shared_buffer, each keeping its block
+    alive. Copying the sequence copies only the
+    list, so one payload may be queued on many
+    connections without duplicating its bytes.
+    Slicing the sequence adjusts the list and
+    releases blocks which are no longer referenced.
+
+    @par Example
+    @code
+    shared_buffer header( make_buffer( h ) );
+    shared_buffer body( make_buffer( b ) );
+    for( auto& c : connections )
+        c.queue( shared_buffers{ header, body } );
+    @endcode
+
+    @see shared_block, shared_buffer
+*/
+class shared_buffers
+{
+    std::vector<shared_buffer> v_;
+
+public:
+    class const_iterator;
+
+    /** The type of each element of the sequence.
+    */
+    using value_type = const_buffer;
+
+    /** Constructor.
+
+        Default-constructed sequences are empty.
+    */
+    shared_buffers() = default;
+
+    /** Constructor.
+    */
+    shared_buffers(
+        std::initializer_list<shared_buffer> init)
+        : v_(init)
+    {
+    }
+
+    /** Return true if the sequence has no buffers.
+    */
+    bool
+    empty() const noexcept
+    {
+        return v_.empty();
+    }
+
+    /** Append a buffer to the sequence.
+    */
+    void
+    push_back(shared_buffer b)
+    {
+        v_.push_back(std::move(b));
+    }
+
+    /** Remove all buffers from the sequence.
+    */
+    void
+    clear() noexcept
+    {
+        v_.clear();
+    }
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    /** Remove a slice from the sequence.
+    */
+    friend
+    void
+    tag_invoke(
+        slice_tag const&,
+        shared_buffers& bs,
+        slice_how how,
+        std::size_t n)
+    {
+        bs.do_slice(how, n);
+    }
+
+    friend
+    std::size_t
+    tag_invoke(
+        size_tag const&,
+        shared_buffers const& bs) noexcept
+    {
+        std::size_t n = 0;
+        for(auto const& b : bs.v_)
+            n += b.size();
+        return n;
+    }
+
+private:
+    void
+    do_slice(
+        slice_how how,
+        std::size_t n)
+    {
+        auto& v = v_;
+        switch(how)
+        {
+        case slice_how::remove_prefix:
+        {
+            auto it = v.begin();
+            while(it != v.end() && n >= it->size())
+                n -= (it++)->size();
+            v.erase(v.begin(), it);
+            if(! v.empty())
+                tag_invoke(slice_tag{}, v.front(),
+                    slice_how::remove_prefix, n);
+            return;
+        }
+
+        case slice_how::keep_prefix:
+        {
+            auto it = v.begin();
+            while(it != v.end() && n > it->size())
+                n -= (it++)->size();
+            if(it == v.end())
+                return;
+            if(n == 0)
+            {
+                v.erase(it, v.end());
+                return;
+            }
+            tag_invoke(slice_tag{}, *it,
+                slice_how::keep_prefix, n);
+            v.erase(it + 1, v.end());
+            return;
+        }
+
+        case slice_how::remove_suffix:
+        {
+            auto it = v.end();
+            while(it != v.begin() && n >= (it - 1)->size())
+                n -= (--it)->size();
+            v.erase(it, v.end());
+            if(! v.empty())
+                tag_invoke(slice_tag{}, v.back(),
+                    slice_how::remove_suffix, n);
+            return;
+        }
+
+        case slice_how::keep_suffix:
+        {
+            auto it = v.end();
+            while(it != v.begin() && n > (it - 1)->size())
+                n -= (--it)->size();
+            if(it == v.begin())
+                return;
+            --it;
+            if(n == 0)
+            {
+                v.erase(v.begin(), it + 1);
+                return;
+            }
+            tag_invoke(slice_tag{}, *it,
+                slice_how::keep_suffix, n);
+            v.erase(v.begin(), it);
+            return;
+        }
+        }
+    }
+};
+
+template<>
+struct has_suffix_slice<shared_buffers>
+    : std::true_type
+{
+};
+
+//------------------------------------------------
+
+/** The iterator type of @ref shared_buffers.
+*/
+class shared_buffers::const_iterator
+{
+    shared_buffer const* p_ = nullptr;
+
+    friend class shared_buffers;
+
+    explicit
+    const_iterator(
+        shared_buffer const* p) noexcept
+        : p_(p)
+    {
+    }
+
+public:
+    using value_type = const_buffer;
+    using reference = const_buffer;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::bidirectional_iterator_tag;
+
+    const_iterator() = default;
+
+    bool
+    operator==(
+        const_iterator const& other) const noexcept
+    {
+        return p_ == other.p_;
+    }
+
+    bool
+    operator!=(
+        const_iterator const& other) const noexcept
+    {
+        return p_ != other.p_;
+    }
+
+    reference
+    operator*() const noexcept
+    {
+        return *p_->begin();
+    }
+
+    const_iterator&
+    operator++() noexcept
+    {
+        ++p_;
+        return *this;
+    }
+
+    const_iterator
+    operator++(int) noexcept
+    {
+        auto temp = *this;
+        ++p_;
+        return temp;
+    }
+
+    const_iterator&
+    operator--() noexcept
+    {
+        --p_;
+        return *this;
+    }
+
+    const_iterator
+    operator--(int) noexcept
+    {
+        auto temp = *this;
+        --p_;
+        return temp;
+    }
+};
+
+inline
+auto
+shared_buffers::
+begin() const noexcept ->
+    const_iterator
+{
+    return const_iterator(v_.data());
+}
+
+inline
+auto
+shared_buffers::
+end() const noexcept ->
+    const_iterator
+{
+    return const_iterator(
+        v_.data() + v_.size());
+}
+
+} // buffers
+} // boost
+
+#endif
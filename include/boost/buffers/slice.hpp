@@ -14,14 +14,17 @@
 #include <boost/buffers/buffer.hpp>
 #include <boost/buffers/range.hpp>
 #include <boost/assert.hpp>
+#include <boost/core/span.hpp>
 #include <array>
 #include <iterator>
 #include <type_traits>
+#include <utility>
 
 namespace boost {
 namespace buffers {
 
 template<class T> class slice_of;
+template<class Buffer> class span_slice;
 
 namespace detail {
 
@@ -36,18 +39,47 @@ struct has_tag_invoke<T, decltype(tag_invoke(
     std::declval<std::size_t>()))>
     : std::true_type {};
 
+template<class T>
+struct slice_type_impl
+{
+    using type = typename std::conditional<
+        has_tag_invoke<T>::value,
+        T, slice_of<T> >::type;
+};
+
+template<class Buffer, std::size_t E>
+struct slice_type_impl<span<Buffer, E>>
+{
+    using type = typename std::conditional<
+        std::is_same<typename std::remove_const<Buffer>::type,
+            const_buffer>::value ||
+        std::is_same<typename std::remove_const<Buffer>::type,
+            mutable_buffer>::value,
+        span_slice<typename std::remove_const<Buffer>::type>,
+        slice_of<span<Buffer, E>> >::type;
+};
+
 } // detail
 
 /** Alias for the type representing a slice of T
+
+    Spans of @ref const_buffer or @ref mutable_buffer
+    are sliced with @ref span_slice. Types which
+    customize slicing are their own slice type, and
+    all others are wrapped in @ref slice_of.
 */
 template<class T>
-using slice_type = typename std::conditional<
-    detail::has_tag_invoke<T>::value,
-    T, slice_of<T> >::type;
+using slice_type = typename
+    detail::slice_type_impl<T>::type;
 
 //------------------------------------------------
 
 /** A wrapper enabling a buffer sequence to be consumed
+
+    Construction is constant time apart from copying
+    the sequence. Operations which trim from the front
+    only visit the buffers they cover, so taking a
+    small prefix of a long sequence is cheap.
 */
 template<class BufferSequence>
 class slice_of
@@ -67,11 +99,19 @@ class slice_of
     using difference_type =
         typename std::iterator_traits<iter_type>::difference_type;
 
+    // A position in bs_, counted from whichever
+    // end of the sequence it was last moved from
+    struct pos
+    {
+        difference_type n;
+        bool from_end;
+    };
+
     BufferSequence bs_;
-    difference_type begin_ = 0; // index of first buffer in sequence
-    difference_type end_ = 0;   // 1 + index of last buffer in sequence
-    std::size_t len_ = 0;       // length of bs_
-    std::size_t size_ = 0;      // total bytes
+    iter_type begin_it_;        // first buffer in sequence
+    iter_type end_it_;          // one past the last buffer
+    pos begin_ = { 0, false };  // position of begin_it_
+    pos end_ = { 0, true };     // position of end_it_
     std::size_t prefix_ = 0;    // used prefix bytes
     std::size_t suffix_ = 0;    // used suffix bytes
 
@@ -88,7 +128,11 @@ public:
 
     /** Constructor
     */
-    slice_of() = default;
+    slice_of()
+        : bs_()
+    {
+        reset_iters();
+    }
 
     /** Constructor
     */
@@ -96,20 +140,70 @@ public:
         BufferSequence const& bs)
         : bs_(bs)
     {
-        iter_type it = buffers::begin(bs_);
-        iter_type eit = buffers::end(bs_);
-        begin_ = 0;
-        end_ = std::distance(it, eit);
-        while(it != eit)
+        reset_iters();
+    }
+
+    /** Constructor
+
+        The copy refers to its own copy of the
+        buffer sequence.
+    */
+    slice_of(
+        slice_of const& other)
+        : bs_(other.bs_)
+        , begin_(other.begin_)
+        , end_(other.end_)
+        , prefix_(other.prefix_)
+        , suffix_(other.suffix_)
+    {
+        reset_iters();
+    }
+
+    /** Constructor
+    */
+    slice_of(
+        slice_of&& other)
+        : bs_(std::move(other.bs_))
+        , begin_(other.begin_)
+        , end_(other.end_)
+        , prefix_(other.prefix_)
+        , suffix_(other.suffix_)
+    {
+        reset_iters();
+    }
+
+    /** Assignment
+    */
+    slice_of&
+    operator=(
+        slice_of const& other)
+    {
+        if(this != &other)
+        {
+            bs_ = other.bs_;
+            assign_state(other);
+        }
+        return *this;
+    }
+
+    /** Assignment
+    */
+    slice_of&
+    operator=(
+        slice_of&& other)
+    {
+        if(this != &other)
         {
-            value_type b(*it);
-            size_ += b.size();
-            ++len_;
-            ++it;
+            bs_ = std::move(other.bs_);
+            assign_state(other);
         }
+        return *this;
     }
 
     /** Return an iterator to the beginning of the sequence
+
+        Iterators refer to this object and are
+        invalidated when it is moved or assigned.
     */
     const_iterator
     begin() const noexcept;
@@ -130,134 +224,224 @@ public:
         bs.slice_impl(how, n);
     }
 
+    friend
+    std::size_t
+    tag_invoke(
+        size_tag const&,
+        slice_of<BufferSequence> const& bs) noexcept
+    {
+        return bs.size_impl();
+    }
+
 private:
-    iter_type
-    begin_iter_impl() const noexcept
+    // Point the cached iterators into bs_. This is
+    // constant time for random access sequences.
+    void
+    reset_iters()
     {
-        iter_type it = buffers::begin(bs_);
-        std::advance(it, begin_);
-        return it;
+        begin_it_ = iter_at(begin_);
+        end_it_ = iter_at(end_);
     }
 
     iter_type
-    end_iter_impl() const noexcept
+    iter_at(pos p) const
     {
+        if(p.from_end)
+        {
+            iter_type it = buffers::end(bs_);
+            std::advance(it, -p.n);
+            return it;
+        }
         iter_type it = buffers::begin(bs_);
-        std::advance(it, end_);
+        std::advance(it, p.n);
         return it;
     }
 
+    static
     void
-    remove_prefix_impl(
-        std::size_t n)
+    inc(pos& p) noexcept
     {
-        if(n > size_)
-            n = size_;
+        if(p.from_end)
+            --p.n;
+        else
+            ++p.n;
+    }
 
-        // nice hack to simplify the loop (M. Nejati)
-        n += prefix_;
-        size_ += prefix_;
-        prefix_ = 0;
+    static
+    void
+    dec(pos& p) noexcept
+    {
+        if(p.from_end)
+            ++p.n;
+        else
+            --p.n;
+    }
 
-        iter_type it = begin_iter_impl();
+    void
+    assign_state(
+        slice_of const& other)
+    {
+        begin_ = other.begin_;
+        end_ = other.end_;
+        prefix_ = other.prefix_;
+        suffix_ = other.suffix_;
+        reset_iters();
+    }
 
-        while(n > 0 && begin_ != end_)
+    // Return the number of bytes used in the
+    // buffer at it, whose successor is next
+    std::size_t
+    used(
+        iter_type const& it,
+        iter_type const& next) const noexcept
+    {
+        std::size_t n = value_type(*it).size();
+        if(it == begin_it_)
+            n -= prefix_;
+        if(next == end_it_)
+            n -= suffix_;
+        return n;
+    }
+
+    std::size_t
+    size_impl() const noexcept
+    {
+        std::size_t n = 0;
+        iter_type it = begin_it_;
+        while(it != end_it_)
         {
-            value_type b = *it;
-            if(n < b.size())
+            iter_type next = it;
+            ++next;
+            n += used(it, next);
+            it = next;
+        }
+        return n;
+    }
+
+    void
+    set_empty() noexcept
+    {
+        end_it_ = begin_it_;
+        end_ = begin_;
+        prefix_ = 0;
+        suffix_ = 0;
+    }
+
+    void
+    remove_prefix_impl(
+        std::size_t n)
+    {
+        while(n > 0 && begin_it_ != end_it_)
+        {
+            iter_type next = begin_it_;
+            ++next;
+            auto const m = used(begin_it_, next);
+            if(n < m)
             {
-                prefix_ = n;
-                size_ -= n;
-                break;
+                prefix_ += n;
+                return;
             }
-            n -= b.size();
-            size_ -= b.size();
-            ++begin_;
-            ++it;
-            --len_;
+            n -= m;
+            prefix_ = 0;
+            begin_it_ = next;
+            inc(begin_);
         }
+        if(begin_it_ == end_it_)
+            set_empty();
     }
 
     void
-    remove_suffix_impl(
+    keep_prefix_impl(
         std::size_t n)
     {
-        if(size_ == 0)
+        if(n == 0)
         {
-            BOOST_ASSERT(begin_ == end_);
+            set_empty();
             return;
         }
-        BOOST_ASSERT(begin_ != end_);
-
-        if(n > size_)
-            n = size_;
-
-        n += suffix_;
-        size_ += suffix_;
-        suffix_ = 0;
-
-        iter_type bit = begin_iter_impl();
-        iter_type it = end_iter_impl();
-        it--;
-
-        while(it != bit)
+        iter_type it = begin_it_;
+        pos p = begin_;
+        while(it != end_it_)
         {
-            value_type b = *it;
-            if(n < b.size())
+            iter_type next = it;
+            ++next;
+            auto const m = used(it, next);
+            if(n <= m)
             {
-                suffix_ = n;
-                size_ -= n;
+                if(next == end_it_ && n == m)
+                    return;
+                std::size_t skip = 0;
+                if(it == begin_it_)
+                    skip = prefix_;
+                suffix_ = value_type(*it).size() - skip - n;
+                end_it_ = next;
+                end_ = p;
+                inc(end_);
                 return;
             }
-            n -= b.size();
-            size_ -= b.size();
-            --it;
-            --end_;
-            --len_;
-        }
-        value_type b = *it;
-        auto m = b.size() - prefix_;
-        if(n < m)
-        {
-            suffix_ = n;
-            size_ -= n;
-            return;
+            n -= m;
+            it = next;
+            inc(p);
         }
-        end_ = begin_;
-        len_ = 0;
-        size_ = 0;
     }
 
     void
-    keep_prefix_impl(
+    remove_suffix_impl(
         std::size_t n)
     {
-        if(n >= size_)
-            return;
-        if(n == 0)
+        while(n > 0 && begin_it_ != end_it_)
         {
-            end_ = begin_;
-            len_ = 0;
-            size_ = 0;
-            return;
+            iter_type it = end_it_;
+            --it;
+            auto const m = used(it, end_it_);
+            if(n < m)
+            {
+                suffix_ += n;
+                return;
+            }
+            n -= m;
+            suffix_ = 0;
+            end_it_ = it;
+            dec(end_);
         }
-        remove_suffix_impl(size_ - n);
+        if(begin_it_ == end_it_)
+            set_empty();
     }
 
     void
     keep_suffix_impl(
         std::size_t n)
     {
-        if(n >= size_)
-            return;
         if(n == 0)
         {
+            begin_it_ = end_it_;
             begin_ = end_;
-            len_ = 0;
-            size_ = 0;
+            prefix_ = 0;
+            suffix_ = 0;
             return;
         }
-        remove_prefix_impl(size_ - n);
+        iter_type it = end_it_;
+        pos p = end_;
+        while(it != begin_it_)
+        {
+            iter_type next = it;
+            --it;
+            dec(p);
+            auto const m = used(it, next);
+            if(n <= m)
+            {
+                if(it == begin_it_ && n == m)
+                    return;
+                std::size_t skip = 0;
+                if(next == end_it_)
+                    skip = suffix_;
+                prefix_ = value_type(*it).size() - skip - n;
+                begin_it_ = it;
+                begin_ = p;
+                return;
+            }
+            n -= m;
+        }
     }
 
     void
@@ -277,6 +461,16 @@ private:
             keep_prefix_impl(n);
             break;
         }
+        case slice_how::remove_suffix:
+        {
+            remove_suffix_impl(n);
+            break;
+        }
+        case slice_how::keep_suffix:
+        {
+            keep_suffix_impl(n);
+            break;
+        }
         }
     }
 };
@@ -291,28 +485,16 @@ class slice_of<BufferSequence>::
         slice_of::iter_type;
 
     iter_type it_;
-    // VFALCO we could just point back to
-    // the original sequence to save size
-    std::size_t prefix_ = 0;
-    std::size_t suffix_ = 0;
-    std::size_t i_ = 0;
-    std::size_t n_ = 0;
+    slice_of const* s_ = nullptr;
 
     friend class slice_of<BufferSequence>;
 
     const_iterator(
         iter_type it,
-        std::size_t prefix__,
-        std::size_t suffix__,
-        std::size_t i,
-        std::size_t n) noexcept
+        slice_of const* s) noexcept
         : it_(it)
-        , prefix_(prefix__)
-        , suffix_(suffix__)
-        , i_(i)
-        , n_(n)
+        , s_(s)
     {
-        // n_ is the index of the end iterator
     }
 
 public:
@@ -333,11 +515,8 @@ public:
         const_iterator const& other) const noexcept
     {
         return
-            it_     == other.it_ &&
-            prefix_ == other.prefix_ &&
-            suffix_ == other.suffix_ &&
-            i_      == other.i_ &&
-            n_      == other.n_;
+            it_ == other.it_ &&
+            s_  == other.s_;
     }
 
     bool
@@ -356,22 +535,23 @@ public:
             char*, char const*>::type;
         auto p = reinterpret_cast<P>(v.data());
         auto n = v.size();
-        if(i_ == 0)
+        if(it_ == s_->begin_it_)
         {
-            p += prefix_;
-            n -= prefix_;
+            p += s_->prefix_;
+            n -= s_->prefix_;
         }
-        if(i_ == n_ - 1)
-            n -= suffix_;
+        iter_type next = it_;
+        ++next;
+        if(next == s_->end_it_)
+            n -= s_->suffix_;
         return value_type(p, n);
     }
 
     const_iterator&
     operator++() noexcept
     {
-        BOOST_ASSERT(i_ < n_);
+        BOOST_ASSERT(it_ != s_->end_it_);
         ++it_;
-        ++i_;
         return *this;
     }
 
@@ -386,9 +566,8 @@ public:
     const_iterator&
     operator--() noexcept
     {
-        BOOST_ASSERT(i_ > 0);
+        BOOST_ASSERT(it_ != s_->begin_it_);
         --it_;
-        --i_;
         return *this;
     }
 
@@ -409,8 +588,7 @@ slice_of<BufferSequence>::
 begin() const noexcept ->
     const_iterator
 {
-    return const_iterator(
-        begin_iter_impl(), prefix_, suffix_, 0, len_);
+    return const_iterator(begin_it_, this);
 }
 
 template<class BufferSequence>
@@ -419,12 +597,529 @@ slice_of<BufferSequence>::
 end() const noexcept ->
     const_iterator
 {
-    return const_iterator(
-        end_iter_impl(), prefix_, suffix_, len_, len_);
+    return const_iterator(end_it_, this);
 }
 
 //------------------------------------------------
 
+/** A slice of a span of buffers
+
+    This refers to a contiguous array of buffers
+    owned elsewhere. The first and last buffers are
+    stored already trimmed, so iterators dereference
+    without adjusting the bytes, and trimming visits
+    only the buffers removed.
+
+    @tparam Buffer The element type, which must be
+    @ref const_buffer or @ref mutable_buffer.
+*/
+template<class Buffer>
+class span_slice
+{
+    static_assert(
+        std::is_same<Buffer, const_buffer>::value ||
+        std::is_same<Buffer, mutable_buffer>::value,
+        "Buffer must be const_buffer or mutable_buffer");
+
+    Buffer const* p_ = nullptr; // first buffer
+    std::size_t n_ = 0;         // number of buffers
+    Buffer front_;              // trimmed first buffer
+    Buffer back_;               // trimmed last buffer, if n_ > 1
+
+public:
+    /** The type of values returned by iterators
+    */
+    using value_type = Buffer;
+
+    /** The type of returned iterators
+    */
+    class const_iterator;
+
+    /** Constructor
+    */
+    span_slice() = default;
+
+    /** Constructor
+    */
+    template<std::size_t E>
+    span_slice(
+        span<Buffer const, E> const& s) noexcept
+        : p_(s.data())
+        , n_(s.size())
+    {
+        init();
+    }
+
+    /** Constructor
+    */
+    template<std::size_t E>
+    span_slice(
+        span<Buffer, E> const& s) noexcept
+        : p_(s.data())
+        , n_(s.size())
+    {
+        init();
+    }
+
+    /** Return an iterator to the beginning of the sequence
+
+        Iterators refer to this object and are
+        invalidated when it is modified.
+    */
+    const_iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end of the sequence
+    */
+    const_iterator
+    end() const noexcept;
+
+    friend
+    void
+    tag_invoke(
+        slice_tag const&,
+        span_slice& bs,
+        slice_how how,
+        std::size_t n) noexcept
+    {
+        bs.slice_impl(how, n);
+    }
+
+    friend
+    std::size_t
+    tag_invoke(
+        size_tag const&,
+        span_slice const& bs) noexcept
+    {
+        std::size_t n = 0;
+        for(std::size_t i = 0; i < bs.n_; ++i)
+            n += bs.at(i).size();
+        return n;
+    }
+
+private:
+    void
+    init() noexcept
+    {
+        if(n_ > 0)
+            front_ = p_[0];
+        if(n_ > 1)
+            back_ = p_[n_ - 1];
+    }
+
+    Buffer const&
+    at(std::size_t i) const noexcept
+    {
+        if(i == 0)
+            return front_;
+        if(i == n_ - 1)
+            return back_;
+        return p_[i];
+    }
+
+    void
+    remove_prefix_impl(
+        std::size_t n) noexcept
+    {
+        if(n == 0 || n_ == 0)
+            return;
+        if(n < front_.size())
+        {
+            front_ += n;
+            return;
+        }
+        n -= front_.size();
+        ++p_;
+        --n_;
+        // whole buffers before the last
+        while(n_ > 1 && n >= p_->size())
+        {
+            n -= p_->size();
+            ++p_;
+            --n_;
+        }
+        if(n_ == 0)
+            return;
+        if(n_ > 1)
+            front_ = *p_;
+        else
+            front_ = back_;
+        if(n < front_.size())
+        {
+            front_ += n;
+            return;
+        }
+        ++p_;
+        n_ = 0;
+    }
+
+    void
+    keep_prefix_impl(
+        std::size_t n) noexcept
+    {
+        if(n_ == 0)
+            return;
+        if(n == 0)
+        {
+            n_ = 0;
+            return;
+        }
+        if(n <= front_.size())
+        {
+            tag_invoke(slice_tag{}, front_,
+                slice_how::keep_prefix, n);
+            n_ = 1;
+            return;
+        }
+        if(n_ == 1)
+            return;
+        n -= front_.size();
+        // whole buffers before the last
+        std::size_t i = 1;
+        while(i < n_ - 1 && n > p_[i].size())
+        {
+            n -= p_[i].size();
+            ++i;
+        }
+        if(i < n_ - 1)
+        {
+            back_ = p_[i];
+            n_ = i + 1;
+        }
+        tag_invoke(slice_tag{}, back_,
+            slice_how::keep_prefix, n);
+    }
+
+    void
+    remove_suffix_impl(
+        std::size_t n) noexcept
+    {
+        if(n == 0 || n_ == 0)
+            return;
+        if(n_ == 1)
+        {
+            tag_invoke(slice_tag{}, front_,
+                slice_how::remove_suffix, n);
+            if(front_.size() == 0)
+                n_ = 0;
+            return;
+        }
+        if(n < back_.size())
+        {
+            tag_invoke(slice_tag{}, back_,
+                slice_how::remove_suffix, n);
+            return;
+        }
+        n -= back_.size();
+        --n_;
+        // whole buffers after the first
+        while(n_ > 1 && n >= p_[n_ - 1].size())
+        {
+            n -= p_[n_ - 1].size();
+            --n_;
+        }
+        Buffer* b = &front_;
+        if(n_ > 1)
+        {
+            back_ = p_[n_ - 1];
+            b = &back_;
+        }
+        if(n < b->size())
+        {
+            tag_invoke(slice_tag{}, *b,
+                slice_how::remove_suffix, n);
+            return;
+        }
+        n_ = 0;
+    }
+
+    void
+    keep_suffix_impl(
+        std::size_t n) noexcept
+    {
+        if(n_ == 0)
+            return;
+        if(n == 0)
+        {
+            p_ += n_;
+            n_ = 0;
+            return;
+        }
+        if(n_ == 1)
+        {
+            tag_invoke(slice_tag{}, front_,
+                slice_how::keep_suffix, n);
+            return;
+        }
+        if(n <= back_.size())
+        {
+            tag_invoke(slice_tag{}, back_,
+                slice_how::keep_suffix, n);
+            p_ += n_ - 1;
+            n_ = 1;
+            front_ = back_;
+            return;
+        }
+        n -= back_.size();
+        // whole buffers after the first
+        std::size_t i = n_ - 2;
+        while(i > 0 && n > p_[i].size())
+        {
+            n -= p_[i].size();
+            --i;
+        }
+        if(i > 0)
+        {
+            front_ = p_[i];
+            p_ += i;
+            n_ -= i;
+        }
+        tag_invoke(slice_tag{}, front_,
+            slice_how::keep_suffix, n);
+    }
+
+    void
+    slice_impl(
+        slice_how how,
+        std::size_t n) noexcept
+    {
+        switch(how)
+        {
+        case slice_how::remove_prefix:
+        {
+            remove_prefix_impl(n);
+            break;
+        }
+        case slice_how::keep_prefix:
+        {
+            keep_prefix_impl(n);
+            break;
+        }
+        case slice_how::remove_suffix:
+        {
+            remove_suffix_impl(n);
+            break;
+        }
+        case slice_how::keep_suffix:
+        {
+            keep_suffix_impl(n);
+            break;
+        }
+        }
+    }
+};
+
+//------------------------------------------------
+
+template<class Buffer>
+class span_slice<Buffer>::
+    const_iterator
+{
+    Buffer const* it_ = nullptr;
+    span_slice const* s_ = nullptr;
+
+    friend class span_slice<Buffer>;
+
+    const_iterator(
+        Buffer const* it,
+        span_slice const* s) noexcept
+        : it_(it)
+        , s_(s)
+    {
+    }
+
+public:
+    using value_type = Buffer;
+    using reference = Buffer;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::random_access_iterator_tag;
+
+    const_iterator() = default;
+
+    reference
+    operator*() const noexcept
+    {
+        return s_->at(static_cast<
+            std::size_t>(it_ - s_->p_));
+    }
+
+    reference
+    operator[](difference_type n) const noexcept
+    {
+        return *(*this + n);
+    }
+
+    const_iterator&
+    operator++() noexcept
+    {
+        ++it_;
+        return *this;
+    }
+
+    const_iterator
+    operator++(int) noexcept
+    {
+        auto temp = *this;
+        ++it_;
+        return temp;
+    }
+
+    const_iterator&
+    operator--() noexcept
+    {
+        --it_;
+        return *this;
+    }
+
+    const_iterator
+    operator--(int) noexcept
+    {
+        auto temp = *this;
+        --it_;
+        return temp;
+    }
+
+    const_iterator&
+    operator+=(difference_type n) noexcept
+    {
+        it_ += n;
+        return *this;
+    }
+
+    const_iterator&
+    operator-=(difference_type n) noexcept
+    {
+        it_ -= n;
+        return *this;
+    }
+
+    friend
+    const_iterator
+    operator+(
+        const_iterator it,
+        difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    const_iterator
+    operator+(
+        difference_type n,
+        const_iterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    const_iterator
+    operator-(
+        const_iterator it,
+        difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend
+    difference_type
+    operator-(
+        const_iterator const& a,
+        const_iterator const& b) noexcept
+    {
+        return a.it_ - b.it_;
+    }
+
+    friend
+    bool
+    operator==(
+        const_iterator const& a,
+        const_iterator const& b) noexcept
+    {
+        return a.it_ == b.it_;
+    }
+
+    friend
+    bool
+    operator!=(
+        const_iterator const& a,
+        const_iterator const& b) noexcept
+    {
+        return a.it_ != b.it_;
+    }
+
+    friend
+    bool
+    operator<(
+        const_iterator const& a,
+        const_iterator const& b) noexcept
+    {
+        return a.it_ < b.it_;
+    }
+
+    friend
+    bool
+    operator>(
+        const_iterator const& a,
+        const_iterator const& b) noexcept
+    {
+        return a.it_ > b.it_;
+    }
+
+    friend
+    bool
+    operator<=(
+        const_iterator const& a,
+        const_iterator const& b) noexcept
+    {
+        return a.it_ <= b.it_;
+    }
+
+    friend
+    bool
+    operator>=(
+        const_iterator const& a,
+        const_iterator const& b) noexcept
+    {
+        return a.it_ >= b.it_;
+    }
+};
+
+//------------------------------------------------
+
+template<class Buffer>
+auto
+span_slice<Buffer>::
+begin() const noexcept ->
+    const_iterator
+{
+    return const_iterator(p_, this);
+}
+
+template<class Buffer>
+auto
+span_slice<Buffer>::
+end() const noexcept ->
+    const_iterator
+{
+    return const_iterator(p_ + n_, this);
+}
+
+template<class BufferSequence>
+struct has_suffix_slice<slice_of<BufferSequence>>
+    : std::true_type
+{
+};
+
+template<class Buffer>
+struct has_suffix_slice<span_slice<Buffer>>
+    : std::true_type
+{
+};
+
+//------------------------------------------------
+
 // in-place modify  return value
 // -----------------------------
 // keep_prefix*     prefix
@@ -458,6 +1153,29 @@ constexpr struct keep_suffix_mrdocs_workaround_t
         std::size_t n) const -> typename std::enable_if<
             is_const_buffer_sequence<BufferSequence>::value &&
             detail::has_tag_invoke<BufferSequence>::value>::type
+    {
+        impl(bs, n, has_suffix_slice<BufferSequence>{});
+    }
+
+private:
+    template<class BufferSequence>
+    static
+    void
+    impl(
+        BufferSequence& bs,
+        std::size_t n,
+        std::true_type)
+    {
+        tag_invoke(slice_tag{}, bs, slice_how::keep_suffix, n);
+    }
+
+    template<class BufferSequence>
+    static
+    void
+    impl(
+        BufferSequence& bs,
+        std::size_t n,
+        std::false_type)
     {
         auto n0 = size(bs);
         if(n < n0)
@@ -490,6 +1208,29 @@ constexpr struct remove_suffix_mrdocs_workaround_t
         std::size_t n) const -> typename std::enable_if<
             is_const_buffer_sequence<BufferSequence>::value &&
             detail::has_tag_invoke<BufferSequence>::value>::type
+    {
+        impl(bs, n, has_suffix_slice<BufferSequence>{});
+    }
+
+private:
+    template<class BufferSequence>
+    static
+    void
+    impl(
+        BufferSequence& bs,
+        std::size_t n,
+        std::true_type)
+    {
+        tag_invoke(slice_tag{}, bs, slice_how::remove_suffix, n);
+    }
+
+    template<class BufferSequence>
+    static
+    void
+    impl(
+        BufferSequence& bs,
+        std::size_t n,
+        std::false_type)
     {
         auto n0 = size(bs);
         if(n > 0)
@@ -19,6 +19,20 @@ namespace boost {
 namespace buffers {
 
 /** A dynamic buffer using an underlying string
+
+    Consumed bytes are not erased from the string
+    immediately. The adapter keeps a read offset and
+    moves the readable bytes to the front once the
+    consumed prefix is at least as large as them, or
+    when more space is needed, so consuming is
+    amortized constant time. The string holds exactly
+    the readable bytes when the adapter is destroyed.
+
+    Growing the string for @ref prepare does not fill
+    the new characters when `resize_and_overwrite` is
+    available. Otherwise the string is grown to its
+    full capacity, so each character is filled at
+    most once while the adapter is in use.
 */
 template<
     class CharT,
@@ -29,23 +43,24 @@ class basic_string_buffer
     std::basic_string<
         CharT, Traits, Allocator>* s_;
     std::size_t max_size_;
+    std::size_t in_pos_ = 0;
+    std::size_t in_size_ = 0;
+    std::size_t out_size_ = 0;
 
 public:
     using string_type = std::basic_string<
         CharT, Traits, Allocator>;
 
-    unsigned char* data_ = nullptr;
-    std::size_t in_size_ = 0;
-    std::size_t out_size_ = 0;
-
-public:
     using const_buffers_type = const_buffer;
     using mutable_buffers_type = mutable_buffer;
 
     ~basic_string_buffer()
     {
         if(s_)
+        {
+            compact();
             s_->resize(in_size_);
+        }
     }
 
     /** Constructor.
@@ -54,6 +69,9 @@ public:
         basic_string_buffer&& other) noexcept
         : s_(other.s_)
         , max_size_(other.max_size_)
+        , in_pos_(other.in_pos_)
+        , in_size_(other.in_size_)
+        , out_size_(other.out_size_)
     {
         other.s_ = nullptr;
     }
@@ -105,7 +123,7 @@ public:
     data() const noexcept
     {
         return const_buffers_type(
-            s_->data(), in_size_);
+            s_->data() + in_pos_, in_size_);
     }
 
     mutable_buffers_type
@@ -115,11 +133,15 @@ public:
         if(n > max_size_ - in_size_)
             detail::throw_invalid_argument();
 
-        if( s_->size() < in_size_ + n)
-            s_->resize(in_size_ + n);
+        if( s_->size() < in_pos_ + in_size_ + n)
+        {
+            compact();
+            if( s_->size() < in_size_ + n)
+                grow(in_size_ + n);
+        }
         out_size_ = n;
         return mutable_buffers_type(
-            &(*s_)[in_size_], out_size_);
+            &(*s_)[in_pos_ + in_size_], out_size_);
     }
 
     void commit(std::size_t n) noexcept
@@ -135,15 +157,52 @@ public:
     {
         if(n < in_size_)
         {
-            s_->erase(0, n);
+            in_pos_ += n;
             in_size_ -= n;
+            if(in_pos_ >= in_size_)
+                compact();
         }
         else
         {
+            in_pos_ = 0;
             in_size_ = 0;
         }
         out_size_ = 0;
     }
+
+private:
+    // move the readable bytes to the front,
+    // keeping the size of the string
+    void
+    compact() noexcept
+    {
+        if(in_pos_ == 0)
+            return;
+        if(in_size_ > 0)
+            Traits::move(&(*s_)[0],
+                &(*s_)[in_pos_], in_size_);
+        in_pos_ = 0;
+    }
+
+    // extend the string to at least n characters
+    void
+    grow(std::size_t n)
+    {
+#ifdef __cpp_lib_string_resize_and_overwrite
+        using size_type = typename string_type::size_type;
+        s_->resize_and_overwrite(n,
+            [](CharT*, size_type m) noexcept
+            {
+                return m;
+            });
+#else
+        auto const cap = s_->capacity() < max_size_
+            ? s_->capacity() : max_size_;
+        if(n < cap)
+            n = cap;
+        s_->resize(n);
+#endif
+    }
 };
 
 using string_buffer = basic_string_buffer<char>;
@@ -0,0 +1,433 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_URING_READ_SOURCE_HPP
+#define BOOST_BUFFERS_URING_READ_SOURCE_HPP
+
+#include <boost/buffers/detail/config.hpp>
+#include <boost/buffers/iovec.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <boost/buffers/error.hpp>
+#include <boost/system/error_code.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace buffers {
+
+namespace detail {
+struct uring_state;
+} // detail
+
+class uring_stream_source;
+
+/** A read source which reads ahead with io_uring.
+
+    This reads a regular file through a Linux
+    io_uring. Several reads
+    into internal blocks of registered memory are
+    kept in flight, and each call to @ref read copies
+    completed blocks into the caller's buffers and
+    submits the next reads in the same system call
+    that waits for completions. A large file is read
+    with far fewer system calls than there are reads,
+    and the device works ahead of the caller. Once
+    the blocks read ahead are used up, a request of
+    at least a block is read straight into the
+    caller's buffers instead, split into reads which
+    are in flight together, so it is not copied.
+
+    When io_uring is not available, because the
+    platform is not Linux, the kernel is too old, or
+    the system call is forbidden, reads are performed
+    directly into the caller's buffers with `preadv`.
+
+    This satisfies @ref is_read_source, and provides
+    the optional members `size` and `rewind`. The
+    size of the file is determined when it is opened.
+    Pipes and other streams have neither, and are
+    read with @ref uring_stream_source. Objects are
+    move-only.
+
+    @par Example
+    @code
+    uring_read_source src( "ingest.bin" );
+    char buf[ 65536 ];
+    system::error_code ec;
+    do
+    {
+        auto const n = src.read(
+            mutable_buffer( buf, sizeof( buf ) ), ec );
+        consume( buf, n );
+    }
+    while( ! ec.failed() );
+    @endcode
+*/
+class uring_read_source
+{
+    int fd_ = -1;
+    bool seekable_ = false;
+    std::uint64_t size_ = 0;
+    std::uint64_t pos_ = 0;
+    detail::uring_state* st_ = nullptr;
+
+    friend class uring_stream_source;
+
+public:
+    /** Options used when opening a source.
+    */
+    struct options
+    {
+        /// The number of reads kept in flight
+        std::size_t queue_depth = 4;
+
+        /// The number of bytes in each read
+        std::size_t block_size = 64 * 1024;
+
+        /// Use io_uring when it is available
+        bool use_uring = true;
+    };
+
+    /** Destructor.
+
+        Reads still in flight are cancelled
+        and waited for.
+    */
+    BOOST_BUFFERS_DECL
+    ~uring_read_source();
+
+    /** Constructor.
+
+        Default-constructed objects are empty, and
+        every read returns @ref error::eof.
+    */
+    uring_read_source() = default;
+
+    /** Constructor.
+
+        The file is opened for reading.
+
+        @param path The path of the file.
+
+        @throw system::system_error if the file
+        cannot be opened.
+    */
+    explicit
+    uring_read_source(
+        char const* path)
+        : uring_read_source(path, options())
+    {
+    }
+
+    /** Constructor.
+
+        The file is opened for reading.
+
+        @param path The path of the file.
+
+        @param opt The options for the source.
+
+        @throw system::system_error if the file
+        cannot be opened, or is not a regular file.
+    */
+    BOOST_BUFFERS_DECL
+    uring_read_source(
+        char const* path,
+        options const& opt);
+
+    /** Constructor.
+
+        The source takes ownership of an open file
+        descriptor of a regular file, as if by calling
+        `uring_read_source( fd, options() )`.
+    */
+    explicit
+    uring_read_source(
+        int fd)
+        : uring_read_source(fd, options())
+    {
+    }
+
+    /** Constructor.
+
+        The source takes ownership of an open file
+        descriptor of a regular file, which is read
+        from the beginning. The descriptor is closed
+        if the constructor throws.
+
+        @param fd The file descriptor.
+
+        @param opt The options for the source.
+
+        @throw system::system_error if the file
+        cannot be examined, or is not a regular file.
+    */
+    BOOST_BUFFERS_DECL
+    uring_read_source(
+        int fd,
+        options const& opt);
+
+    /** Constructor.
+
+        The new object takes ownership of the file
+        and of the reads in flight, and `other` is
+        left empty.
+    */
+    uring_read_source(
+        uring_read_source&& other) noexcept
+        : fd_(other.fd_)
+        , seekable_(other.seekable_)
+        , size_(other.size_)
+        , pos_(other.pos_)
+        , st_(other.st_)
+    {
+        other.fd_ = -1;
+        other.seekable_ = false;
+        other.size_ = 0;
+        other.pos_ = 0;
+        other.st_ = nullptr;
+    }
+
+    /** Assignment.
+
+        The file of `*this` is closed, and
+        `other` is left empty.
+    */
+    uring_read_source&
+    operator=(
+        uring_read_source&& other) noexcept
+    {
+        if(this != &other)
+        {
+            uring_read_source tmp(std::move(*this));
+            fd_ = other.fd_;
+            seekable_ = other.seekable_;
+            size_ = other.size_;
+            pos_ = other.pos_;
+            st_ = other.st_;
+            other.fd_ = -1;
+            other.seekable_ = false;
+            other.size_ = 0;
+            other.pos_ = 0;
+            other.st_ = nullptr;
+        }
+        return *this;
+    }
+
+    uring_read_source(
+        uring_read_source const&) = delete;
+
+    uring_read_source& operator=(
+        uring_read_source const&) = delete;
+
+    /** Return true if reads are performed with io_uring.
+    */
+    bool
+    is_uring() const noexcept
+    {
+        return st_ != nullptr;
+    }
+
+    /** Return the size of the file in bytes.
+    */
+    std::uint64_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /** Restart reading from the beginning of the file.
+
+        Reads in flight are waited for.
+    */
+    BOOST_BUFFERS_DECL
+    void
+    rewind();
+
+    /** Read from the source.
+
+        Bytes are read until the buffers are full or
+        the end of the file is reached.
+
+        @return The number of bytes read.
+
+        @param dest The buffers to read into.
+
+        @param ec Set to @ref error::eof when the
+        last byte has been read, or to the error from
+        the system call.
+    */
+    template<class MutableBufferSequence>
+    std::size_t
+    read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        std::size_t total = 0;
+        ::iovec v[batch_size];
+        iovec_cursor<MutableBufferSequence> c(dest);
+        while(! c.empty())
+        {
+            auto const iov = c.prepare(v, batch_size);
+            auto const n = do_read(iov.data(), iov.size(), ec);
+            total += n;
+            if(ec.failed())
+                return total;
+            c.consume(n);
+        }
+        return total;
+    }
+
+private:
+    static constexpr std::size_t batch_size =
+        iov_max < 64 ? iov_max : 64;
+
+    struct stream_t {};
+
+    BOOST_BUFFERS_DECL
+    uring_read_source(
+        char const* path,
+        options const& opt,
+        stream_t);
+
+    BOOST_BUFFERS_DECL
+    uring_read_source(
+        int fd,
+        options const& opt,
+        stream_t);
+
+    void open(char const* path);
+    void init(options const& opt, bool stream);
+
+    BOOST_BUFFERS_DECL
+    std::size_t
+    do_read(
+        ::iovec const* iov,
+        std::size_t n,
+        system::error_code& ec);
+};
+
+//------------------------------------------------
+
+/** A read source which reads a stream with io_uring.
+
+    This reads a pipe, a socket, a character device
+    or any other file descriptor through a Linux
+    io_uring, as @ref uring_read_source does for
+    regular files. A stream has no offsets, so only
+    one read is in flight at a time, to preserve the
+    order of its bytes. When io_uring is not
+    available, reads are performed directly into the
+    caller's buffers with `readv`.
+
+    This satisfies @ref is_read_source. It does not
+    provide `size` or `rewind`, even when the file
+    descriptor refers to a regular file, so
+    @ref any_read_source reports neither. Objects
+    are move-only.
+*/
+class uring_stream_source
+{
+    uring_read_source impl_;
+
+public:
+    /** Options used when opening a source.
+    */
+    using options = uring_read_source::options;
+
+    /** Constructor.
+
+        Default-constructed objects are empty, and
+        every read returns @ref error::eof.
+    */
+    uring_stream_source() = default;
+
+    /** Constructor.
+
+        The file, such as a named pipe, is opened
+        for reading.
+
+        @param path The path of the file.
+
+        @param opt The options for the source.
+
+        @throw system::system_error if the file
+        cannot be opened.
+    */
+    explicit
+    uring_stream_source(
+        char const* path,
+        options const& opt = options())
+        : impl_(path, opt,
+            uring_read_source::stream_t{})
+    {
+    }
+
+    /** Constructor.
+
+        The source takes ownership of an open file
+        descriptor, such as the read end of a pipe.
+        The descriptor is closed if the constructor
+        throws.
+
+        @param fd The file descriptor.
+
+        @param opt The options for the source.
+
+        @throw system::system_error if the file
+        cannot be examined.
+    */
+    explicit
+    uring_stream_source(
+        int fd,
+        options const& opt = options())
+        : impl_(fd, opt,
+            uring_read_source::stream_t{})
+    {
+    }
+
+    /** Return true if reads are performed with io_uring.
+    */
+    bool
+    is_uring() const noexcept
+    {
+        return impl_.is_uring();
+    }
+
+    /** Read from the source.
+
+        Bytes are read until the buffers are full or
+        the end of the stream is reached. This blocks
+        until enough bytes arrive.
+
+        @return The number of bytes read.
+
+        @param dest The buffers to read into.
+
+        @param ec Set to @ref error::eof when the
+        last byte has been read, or to the error from
+        the system call.
+    */
+    template<class MutableBufferSequence>
+    std::size_t
+    read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        return impl_.read(dest, ec);
+    }
+};
+
+} // buffers
+} // boost
+
+#endif
+
+#endif
@@ -0,0 +1,418 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/block_pool.hpp>
+#include <boost/buffers/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace boost {
+namespace buffers {
+namespace detail {
+
+namespace {
+
+// Free blocks are linked through their first bytes
+struct free_block
+{
+    free_block* next;
+};
+
+// A list of free blocks
+struct free_list
+{
+    free_block* head = nullptr;
+    std::size_t count = 0;
+
+    void
+    push(void* p) noexcept
+    {
+        auto const b = static_cast<free_block*>(p);
+        b->next = head;
+        head = b;
+        ++count;
+    }
+
+    void*
+    pop() noexcept
+    {
+        auto const b = head;
+        head = b->next;
+        --count;
+        return b;
+    }
+
+    // Move up to n blocks to the front of other
+    void
+    move_to(
+        free_list& other,
+        std::size_t n) noexcept
+    {
+        while(n-- > 0 && head)
+            other.push(pop());
+    }
+
+    void
+    release() noexcept
+    {
+        while(head)
+            ::operator delete(pop());
+    }
+};
+
+} // (anon)
+
+struct block_pool_cache;
+
+struct block_pool_core
+{
+    std::size_t const block_size;
+    std::size_t const max_retained;
+    std::size_t const cache_size;
+
+    std::atomic<bool> alive{true};
+
+    // guarded by m
+    std::mutex m;
+    free_list depot;
+    std::vector<block_pool_cache*> caches;
+
+    // counts of exited caches, and of
+    // allocations made without a cache
+    std::size_t retired_hits = 0;
+    std::size_t retired_misses = 0;
+
+    block_pool_core(
+        std::size_t block_size_,
+        std::size_t max_retained_,
+        std::size_t cache_size_) noexcept
+        : block_size(block_size_)
+        , max_retained(max_retained_)
+        , cache_size(cache_size_)
+    {
+    }
+};
+
+// The cache of one thread for one pool. Only the
+// owning thread writes to it, except when the pool
+// is destroyed. The counters are atomic so that
+// other threads may read them.
+struct block_pool_cache
+{
+    std::shared_ptr<block_pool_core> core;
+    free_list list;
+    std::atomic<std::size_t> hits{0};
+    std::atomic<std::size_t> misses{0};
+    std::atomic<std::size_t> count{0};
+
+    explicit
+    block_pool_cache(
+        std::shared_ptr<block_pool_core> core_) noexcept
+        : core(std::move(core_))
+    {
+    }
+
+    static
+    void
+    bump(std::atomic<std::size_t>& n) noexcept
+    {
+        // single writer
+        n.store(
+            n.load(std::memory_order_relaxed) + 1,
+            std::memory_order_relaxed);
+    }
+
+    void
+    sync_count() noexcept
+    {
+        count.store(list.count,
+            std::memory_order_relaxed);
+    }
+
+    // Give the blocks back to the pool on thread exit
+    ~block_pool_cache()
+    {
+        std::lock_guard<std::mutex> lock(core->m);
+        if(! core->alive.load(
+                std::memory_order_relaxed))
+            return;
+        list.move_to(core->depot,
+            core->max_retained - (std::min)(
+                core->max_retained, core->depot.count));
+        list.release();
+        core->retired_hits += hits.load(
+            std::memory_order_relaxed);
+        core->retired_misses += misses.load(
+            std::memory_order_relaxed);
+        auto& v = core->caches;
+        v.erase(std::find(v.begin(), v.end(), this));
+    }
+};
+
+namespace {
+
+// The caches of the calling thread
+struct thread_caches
+{
+    std::vector<std::unique_ptr<block_pool_cache>> v;
+
+    ~thread_caches();
+};
+
+// Most recently used cache, to skip the search
+struct last_cache
+{
+    block_pool_core const* core;
+    block_pool_cache* cache;
+};
+
+thread_local thread_caches tls_caches;
+thread_local last_cache tls_last = { nullptr, nullptr };
+thread_local bool tls_exited = false;
+
+thread_caches::
+~thread_caches()
+{
+    tls_exited = true;
+    tls_last = { nullptr, nullptr };
+}
+
+// Return the calling thread's cache for the
+// pool, or null if the thread is exiting
+block_pool_cache*
+local_cache(
+    std::shared_ptr<block_pool_core> const& core)
+{
+    if(tls_last.core == core.get())
+        return tls_last.cache;
+    if(tls_exited)
+        return nullptr;
+
+    auto& v = tls_caches.v;
+    block_pool_cache* c = nullptr;
+    for(auto it = v.begin(); it != v.end();)
+    {
+        if((*it)->core == core)
+        {
+            c = it->get();
+            ++it;
+        }
+        else if(! (*it)->core->alive.load(
+            std::memory_order_relaxed))
+        {
+            // the pool is gone
+            it = v.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    if(! c)
+    {
+        std::unique_ptr<block_pool_cache> up(
+            new block_pool_cache(core));
+        {
+            std::lock_guard<std::mutex> lock(core->m);
+            core->caches.push_back(up.get());
+        }
+        c = up.get();
+        v.push_back(std::move(up));
+    }
+    tls_last = { core.get(), c };
+    return c;
+}
+
+} // (anon)
+
+} // detail
+
+block_pool::
+~block_pool()
+{
+    auto& core = *core_;
+    std::lock_guard<std::mutex> lock(core.m);
+    core.alive.store(false,
+        std::memory_order_relaxed);
+    core.depot.release();
+    for(auto c : core.caches)
+    {
+        c->list.release();
+        c->sync_count();
+    }
+    core.caches.clear();
+}
+
+block_pool::
+block_pool(
+    std::size_t block_size,
+    std::size_t max_retained,
+    std::size_t cache_size)
+{
+    if(block_size == 0)
+        detail::throw_invalid_argument();
+    core_ = std::make_shared<detail::block_pool_core>(
+        (std::max)(block_size, sizeof(void*)),
+        max_retained, cache_size);
+}
+
+std::size_t
+block_pool::
+block_size() const noexcept
+{
+    return core_->block_size;
+}
+
+void*
+block_pool::
+allocate()
+{
+    auto& core = *core_;
+    auto const c = detail::local_cache(core_);
+    if(c && c->list.head)
+    {
+        c->bump(c->hits);
+        auto const p = c->list.pop();
+        c->sync_count();
+        return p;
+    }
+
+    // refill from the depot
+    {
+        std::lock_guard<std::mutex> lock(core.m);
+        if(core.depot.head)
+        {
+            if(! c)
+            {
+                ++core.retired_hits;
+                return core.depot.pop();
+            }
+            core.depot.move_to(c->list,
+                (std::max)(core.cache_size / 2,
+                    std::size_t(1)));
+        }
+    }
+    if(c && c->list.head)
+    {
+        c->bump(c->hits);
+        auto const p = c->list.pop();
+        c->sync_count();
+        return p;
+    }
+
+    if(c)
+    {
+        c->bump(c->misses);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(core.m);
+        ++core.retired_misses;
+    }
+    return ::operator new(core.block_size);
+}
+
+void
+block_pool::
+deallocate(void* p) noexcept
+{
+    BOOST_ASSERT(p != nullptr);
+    auto& core = *core_;
+    detail::block_pool_cache* c = nullptr;
+#ifndef BOOST_NO_EXCEPTIONS
+    try
+    {
+        c = detail::local_cache(core_);
+    }
+    catch(...)
+    {
+    }
+#else
+    c = detail::local_cache(core_);
+#endif
+    detail::free_list overflow;
+    if(c)
+    {
+        c->list.push(p);
+        if(c->list.count > core.cache_size)
+        {
+            // return half of the cache
+            std::lock_guard<std::mutex> lock(core.m);
+            auto const n = c->list.count -
+                core.cache_size / 2;
+            auto const room = core.max_retained - (std::min)(
+                core.max_retained, core.depot.count);
+            c->list.move_to(core.depot, (std::min)(n, room));
+            if(n > room)
+                c->list.move_to(overflow, n - room);
+        }
+        c->sync_count();
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(core.m);
+        if(core.depot.count < core.max_retained)
+            core.depot.push(p);
+        else
+            overflow.push(p);
+    }
+    overflow.release();
+}
+
+auto
+block_pool::
+get_stats() const noexcept ->
+    stats
+{
+    auto& core = *core_;
+    stats st;
+    std::lock_guard<std::mutex> lock(core.m);
+    st.hits = core.retired_hits;
+    st.misses = core.retired_misses;
+    st.retained = core.depot.count;
+    for(auto c : core.caches)
+    {
+        st.hits += c->hits.load(
+            std::memory_order_relaxed);
+        st.misses += c->misses.load(
+            std::memory_order_relaxed);
+        st.retained += c->count.load(
+            std::memory_order_relaxed);
+    }
+    return st;
+}
+
+void
+block_pool::
+trim() noexcept
+{
+    auto& core = *core_;
+    detail::free_list list;
+    {
+        std::lock_guard<std::mutex> lock(core.m);
+        core.depot.move_to(list, core.depot.count);
+    }
+    list.release();
+    if(detail::tls_exited)
+        return;
+    for(auto const& c : detail::tls_caches.v)
+    {
+        if(c->core == core_)
+        {
+            c->list.release();
+            c->sync_count();
+        }
+    }
+}
+
+} // buffers
+} // boost
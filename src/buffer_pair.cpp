@@ -51,6 +51,37 @@ tag_invoke(
         keep_prefix(*p, n);
         return;
     }
+
+    case slice_how::remove_suffix:
+    {
+        auto p = &bs[1];
+        if(n < p->size())
+        {
+            remove_suffix(*p, n);
+            return;
+        }
+        n -= p->size();
+        *p = {};
+        --p;
+        remove_suffix(*p, n);
+        return;
+    }
+
+    case slice_how::keep_suffix:
+    {
+        auto p = &bs[1];
+        if(n <= p->size())
+        {
+            keep_suffix(*p, n);
+            bs[0] = *p;
+            *p = {};
+            return;
+        }
+        n -= p->size();
+        --p;
+        keep_suffix(*p, n);
+        return;
+    }
     }
 }
 
@@ -92,6 +123,37 @@ tag_invoke(
         keep_prefix(*p, n);
         return;
     }
+
+    case slice_how::remove_suffix:
+    {
+        auto p = &bs[1];
+        if(n < p->size())
+        {
+            remove_suffix(*p, n);
+            return;
+        }
+        n -= p->size();
+        *p = {};
+        --p;
+        remove_suffix(*p, n);
+        return;
+    }
+
+    case slice_how::keep_suffix:
+    {
+        auto p = &bs[1];
+        if(n <= p->size())
+        {
+            keep_suffix(*p, n);
+            bs[0] = *p;
+            *p = {};
+            return;
+        }
+        n -= p->size();
+        --p;
+        keep_suffix(*p, n);
+        return;
+    }
     }
 }
 
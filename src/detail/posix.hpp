@@ -0,0 +1,55 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#ifndef BOOST_BUFFERS_SRC_DETAIL_POSIX_HPP
+#define BOOST_BUFFERS_SRC_DETAIL_POSIX_HPP
+
+// Helpers shared by the sources which use
+// file descriptors. Only include this from
+// code built for POSIX systems.
+
+#include <boost/system/error_code.hpp>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef O_CLOEXEC
+#define O_CLOEXEC 0
+#endif
+
+namespace boost {
+namespace buffers {
+namespace detail {
+
+inline
+system::error_code
+last_error() noexcept
+{
+    return system::error_code(
+        errno, system::system_category());
+}
+
+// Closes a file descriptor on scope exit,
+// unless it is released
+struct fd_guard
+{
+    int fd;
+
+    ~fd_guard()
+    {
+        if(fd != -1)
+            ::close(fd);
+    }
+};
+
+} // detail
+} // buffers
+} // boost
+
+#endif
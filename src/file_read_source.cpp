@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/file_read_source.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <boost/buffers/detail/except.hpp>
+#include <sys/stat.h>
+
+#include "detail/posix.hpp"
+
+namespace boost {
+namespace buffers {
+
+file_read_source::
+~file_read_source()
+{
+    if(fd_ != -1)
+        ::close(fd_);
+}
+
+file_read_source::
+file_read_source(
+    char const* path,
+    options const& opt)
+{
+    int flags = O_RDONLY | O_CLOEXEC;
+#ifdef O_DIRECT
+    if(opt.direct)
+        flags |= O_DIRECT;
+#endif
+    detail::fd_guard fd{ ::open(path, flags) };
+    if(fd.fd == -1)
+        detail::throw_system_error(detail::last_error());
+#if ! defined(O_DIRECT) && defined(F_NOCACHE)
+    if(opt.direct && ::fcntl(fd.fd, F_NOCACHE, 1) == -1)
+        detail::throw_system_error(detail::last_error());
+#endif
+    struct stat st;
+    if(::fstat(fd.fd, &st) == -1)
+        detail::throw_system_error(detail::last_error());
+
+    // a stream has no size or offsets
+    if(! S_ISREG(st.st_mode))
+        detail::throw_system_error(
+            system::errc::make_error_code(
+                system::errc::invalid_argument));
+    size_ = static_cast<std::uint64_t>(st.st_size);
+    fd_ = fd.fd;
+    fd.fd = -1;
+}
+
+std::size_t
+file_read_source::
+do_read(
+    ::iovec const* iov,
+    std::size_t n,
+    system::error_code& ec)
+{
+    if(pos_ >= size_)
+    {
+        ec = error::eof;
+        return 0;
+    }
+    std::size_t want = 0;
+    for(std::size_t i = 0; i < n; ++i)
+        want += iov[i].iov_len;
+    ssize_t result;
+    do
+    {
+        result = ::preadv(fd_, iov, static_cast<int>(n),
+            static_cast<off_t>(pos_));
+    }
+    while(result == -1 && errno == EINTR);
+    if(result == -1)
+    {
+        ec = detail::last_error();
+        return 0;
+    }
+    auto const nread = static_cast<std::size_t>(result);
+    pos_ += nread;
+
+    // a short read of a regular file
+    // only happens at the end
+    if(nread < want || pos_ >= size_)
+        ec = error::eof;
+    else
+        ec = {};
+    return nread;
+}
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/mapped_file_source.hpp>
+#include <boost/buffers/detail/except.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+#include <boost/assert.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "detail/posix.hpp"
+#endif
+
+namespace boost {
+namespace buffers {
+
+#ifdef BOOST_HAS_UNISTD_H
+
+namespace {
+
+// The alignment which lets a file mapping
+// be backed by transparent huge pages
+constexpr std::size_t huge_page_size =
+    2 * 1024 * 1024;
+
+// Map len bytes of the file at the page-aligned
+// offset, at an address congruent to the offset
+// modulo the huge page size
+void*
+map_huge(
+    int fd,
+    std::uint64_t offset,
+    std::size_t len,
+    std::size_t page)
+{
+    if(len > std::size_t(-1) - huge_page_size)
+        detail::throw_length_error();
+    auto const reserve = len + huge_page_size;
+    void* const r = ::mmap(nullptr, reserve,
+        PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(r == MAP_FAILED)
+        detail::throw_system_error(detail::last_error());
+    auto const lo = reinterpret_cast<std::uintptr_t>(r);
+    auto addr = lo - lo % huge_page_size +
+        static_cast<std::size_t>(offset % huge_page_size);
+    if(addr < lo)
+        addr += huge_page_size;
+    void* const p = ::mmap(reinterpret_cast<void*>(addr),
+        len, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd,
+        static_cast<off_t>(offset));
+    if(p == MAP_FAILED)
+    {
+        auto const ec = detail::last_error();
+        ::munmap(r, reserve);
+        detail::throw_system_error(ec);
+    }
+
+    // release the unused ends of the reservation
+    auto const end = addr + ((len + page - 1) & ~(page - 1));
+    if(addr > lo)
+        ::munmap(r, addr - lo);
+    if(lo + reserve > end)
+        ::munmap(reinterpret_cast<void*>(end),
+            lo + reserve - end);
+#ifdef MADV_HUGEPAGE
+    ::madvise(p, len, MADV_HUGEPAGE);
+#endif
+    return p;
+}
+
+} // (anon)
+
+mapped_file_source::
+~mapped_file_source()
+{
+    if(base_)
+        ::munmap(base_, map_size_);
+}
+
+mapped_file_source::
+mapped_file_source(
+    char const* path,
+    std::uint64_t offset,
+    std::size_t size,
+    options const& opt)
+{
+    detail::fd_guard fd{ ::open(path, O_RDONLY | O_CLOEXEC) };
+    if(fd.fd == -1)
+        detail::throw_system_error(detail::last_error());
+    struct stat st;
+    if(::fstat(fd.fd, &st) == -1)
+        detail::throw_system_error(detail::last_error());
+    auto const file_size =
+        static_cast<std::uint64_t>(st.st_size);
+    if(offset >= file_size || size == 0)
+        return;
+    if(size > file_size - offset)
+        size = static_cast<std::size_t>(
+            file_size - offset);
+
+    // mappings start on a page boundary
+    std::size_t const page =
+        static_cast<std::size_t>(
+            ::sysconf(_SC_PAGESIZE));
+    auto const lead = static_cast<std::size_t>(
+        offset % page);
+    if(size > std::size_t(-1) - lead)
+        detail::throw_length_error();
+    auto const len = lead + size;
+    auto const map_offset = offset - lead;
+
+    void* p;
+    if(opt.huge_pages)
+    {
+        p = map_huge(fd.fd, map_offset, len, page);
+    }
+    else
+    {
+        p = ::mmap(nullptr, len, PROT_READ,
+            MAP_PRIVATE, fd.fd,
+            static_cast<off_t>(map_offset));
+        if(p == MAP_FAILED)
+            detail::throw_system_error(detail::last_error());
+    }
+    base_ = p;
+    map_size_ = len;
+    data_ = const_buffer(
+        static_cast<unsigned char const*>(p) + lead,
+        size);
+    if(opt.hint != advice::normal)
+        advise(opt.hint);
+}
+
+void
+mapped_file_source::
+advise(advice a) const noexcept
+{
+    if(! base_)
+        return;
+    int how = MADV_NORMAL;
+    switch(a)
+    {
+    case advice::normal:
+        break;
+    case advice::sequential:
+        how = MADV_SEQUENTIAL;
+        break;
+    case advice::random:
+        how = MADV_RANDOM;
+        break;
+    case advice::willneed:
+        how = MADV_WILLNEED;
+        break;
+    }
+    ::madvise(base_, map_size_, how);
+}
+
+#else
+
+mapped_file_source::
+~mapped_file_source()
+{
+}
+
+mapped_file_source::
+mapped_file_source(
+    char const*,
+    std::uint64_t,
+    std::size_t,
+    options const&)
+{
+    detail::throw_system_error(
+        system::errc::make_error_code(
+            system::errc::not_supported));
+}
+
+void
+mapped_file_source::
+advise(advice) const noexcept
+{
+}
+
+#endif
+
+} // buffers
+} // boost
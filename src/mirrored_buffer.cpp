@@ -0,0 +1,121 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/mirrored_buffer.hpp>
+#include <boost/buffers/detail/except.hpp>
+
+#ifdef __linux__
+#include <boost/assert.hpp>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+#include "detail/posix.hpp"
+#endif
+
+namespace boost {
+namespace buffers {
+
+#ifdef __linux__
+
+namespace {
+
+int
+create_memfd() noexcept
+{
+    // Use the system call directly, as the
+    // wrapper needs a recent C library
+#ifdef SYS_memfd_create
+    return static_cast<int>(::syscall(
+        SYS_memfd_create,
+        "boost.buffers.mirrored_buffer",
+        MFD_CLOEXEC));
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+} // (anon)
+
+mirrored_buffer::
+~mirrored_buffer()
+{
+    if(base_)
+        ::munmap(base_, 2 * cap_);
+}
+
+mirrored_buffer::
+mirrored_buffer(
+    std::size_t capacity)
+{
+    std::size_t const page =
+        static_cast<std::size_t>(
+            ::sysconf(_SC_PAGESIZE));
+    if(capacity == 0)
+        capacity = page;
+    // both mappings must fit
+    if(capacity > (std::size_t(-1) / 2) - page)
+        detail::throw_length_error();
+    capacity = (capacity + page - 1) & ~(page - 1);
+
+    detail::fd_guard fd{ create_memfd() };
+    if(fd.fd == -1)
+        detail::throw_system_error(detail::last_error());
+    if(::ftruncate(fd.fd,
+        static_cast<off_t>(capacity)) == -1)
+        detail::throw_system_error(detail::last_error());
+
+    // Reserve a range covering both mappings, then
+    // replace each half with the same file pages.
+    void* const p = ::mmap(nullptr, 2 * capacity,
+        PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+        detail::throw_system_error(detail::last_error());
+    auto const base = static_cast<unsigned char*>(p);
+    for(int i = 0; i < 2; ++i)
+    {
+        void* const q = ::mmap(base + i * capacity,
+            capacity, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_FIXED, fd.fd, 0);
+        if(q == MAP_FAILED)
+        {
+            auto const ec = detail::last_error();
+            ::munmap(p, 2 * capacity);
+            detail::throw_system_error(ec);
+        }
+        BOOST_ASSERT(q == base + i * capacity);
+    }
+    base_ = base;
+    cap_ = capacity;
+}
+
+#else
+
+mirrored_buffer::
+~mirrored_buffer()
+{
+}
+
+mirrored_buffer::
+mirrored_buffer(
+    std::size_t)
+{
+    detail::throw_system_error(
+        system::errc::make_error_code(
+            system::errc::not_supported));
+}
+
+#endif
+
+} // buffers
+} // boost
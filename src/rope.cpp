@@ -0,0 +1,396 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/rope.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace boost {
+namespace buffers {
+
+namespace {
+
+using node = detail::rope_node;
+
+int
+height(node const* n) noexcept
+{
+    return n ? n->height : 0;
+}
+
+std::size_t
+bytes(node const* n) noexcept
+{
+    return n ? n->bytes : 0;
+}
+
+// Make l and r the children of n
+// and recompute the cached values
+void
+set(node* n, node* l, node* r) noexcept
+{
+    n->left = l;
+    n->right = r;
+    if(l)
+        l->parent = n;
+    if(r)
+        r->parent = n;
+    n->height = 1 + (std::max)(
+        height(l), height(r));
+    n->bytes =
+        bytes(l) + n->seg.size() + bytes(r);
+}
+
+node*
+rotate_left(node* x) noexcept
+{
+    auto const y = x->right;
+    set(x, x->left, y->left);
+    set(y, x, y->right);
+    return y;
+}
+
+node*
+rotate_right(node* x) noexcept
+{
+    auto const y = x->left;
+    set(x, y->right, x->right);
+    set(y, y->left, x);
+    return y;
+}
+
+// Join when l is taller than r
+node*
+join_right(node* l, node* k, node* r) noexcept
+{
+    auto const ll = l->left;
+    auto const lr = l->right;
+    if(height(lr) <= height(r) + 1)
+    {
+        set(k, lr, r);
+        if(height(k) <= height(ll) + 1)
+        {
+            set(l, ll, k);
+            return l;
+        }
+        set(l, ll, rotate_right(k));
+        return rotate_left(l);
+    }
+    auto const t = join_right(lr, k, r);
+    set(l, ll, t);
+    if(height(t) <= height(ll) + 1)
+        return l;
+    return rotate_left(l);
+}
+
+// Join when r is taller than l
+node*
+join_left(node* l, node* k, node* r) noexcept
+{
+    auto const rl = r->left;
+    auto const rr = r->right;
+    if(height(rl) <= height(l) + 1)
+    {
+        set(k, l, rl);
+        if(height(k) <= height(rr) + 1)
+        {
+            set(r, k, rr);
+            return r;
+        }
+        set(r, rotate_left(k), rr);
+        return rotate_right(r);
+    }
+    auto const t = join_left(l, k, rl);
+    set(r, t, rr);
+    if(height(t) <= height(rr) + 1)
+        return r;
+    return rotate_right(r);
+}
+
+// Return the tree holding the segments of l,
+// then k, then the segments of r. This takes
+// time proportional to the difference in height.
+node*
+join(node* l, node* k, node* r) noexcept
+{
+    node* t;
+    if(height(l) > height(r) + 1)
+        t = join_right(l, k, r);
+    else if(height(r) > height(l) + 1)
+        t = join_left(l, k, r);
+    else
+    {
+        set(k, l, r);
+        t = k;
+    }
+    t->parent = nullptr;
+    return t;
+}
+
+// Split t into the trees holding the first n
+// bytes and the remaining bytes. If n falls
+// inside a segment, the spare node receives
+// the second part and is set to null.
+std::pair<node*, node*>
+split_tree(node* t, std::size_t n, node*& spare) noexcept
+{
+    if(! t)
+        return { nullptr, nullptr };
+    auto const l = t->left;
+    auto const r = t->right;
+    auto const lb = bytes(l);
+    auto const sb = t->seg.size();
+    if(n < lb)
+    {
+        auto const p = split_tree(l, n, spare);
+        return { p.first, join(p.second, t, r) };
+    }
+    if(n == lb)
+        return { l, join(nullptr, t, r) };
+    if(n < lb + sb)
+    {
+        BOOST_ASSERT(spare);
+        auto const k = spare;
+        spare = nullptr;
+        auto const d = n - lb;
+        k->seg = const_buffer(static_cast<
+            unsigned char const*>(t->seg.data()) + d,
+            sb - d);
+        t->seg = const_buffer(t->seg.data(), d);
+        return {
+            join(l, t, nullptr),
+            join(nullptr, k, r) };
+    }
+    if(n == lb + sb)
+        return { join(l, t, nullptr), r };
+    auto const p = split_tree(r, n - lb - sb, spare);
+    return { join(l, t, p.first), p.second };
+}
+
+void
+destroy(node* n) noexcept
+{
+    while(n)
+    {
+        destroy(n->right);
+        auto const left = n->left;
+        delete n;
+        n = left;
+    }
+}
+
+// Destroys a tree on scope exit
+struct tree_guard
+{
+    node* n;
+
+    ~tree_guard()
+    {
+        destroy(n);
+    }
+};
+
+node*
+clone(node const* n)
+{
+    if(! n)
+        return nullptr;
+    tree_guard g{ new node(*n) };
+    g.n->left = nullptr;
+    g.n->right = nullptr;
+    g.n->parent = nullptr;
+    g.n->left = clone(n->left);
+    g.n->right = clone(n->right);
+    set(g.n, g.n->left, g.n->right);
+    auto const t = g.n;
+    g.n = nullptr;
+    return t;
+}
+
+node*
+make_root(node* n) noexcept
+{
+    if(n)
+        n->parent = nullptr;
+    return n;
+}
+
+} // (anon)
+
+rope::
+~rope()
+{
+    destroy(root_);
+}
+
+rope::
+rope(rope const& other)
+    : root_(clone(other.root_))
+{
+}
+
+rope&
+rope::
+operator=(rope const& other)
+{
+    rope temp(other);
+    std::swap(root_, temp.root_);
+    return *this;
+}
+
+void
+rope::
+append(const_buffer b)
+{
+    if(b.size() == 0)
+        return;
+    auto const k = new node();
+    k->seg = b;
+    root_ = join(root_, k, nullptr);
+}
+
+void
+rope::
+append(rope&& other) noexcept
+{
+    if(! other.root_)
+        return;
+    if(! root_)
+    {
+        std::swap(root_, other.root_);
+        return;
+    }
+
+    // detach the first segment of other
+    // to use as the joining node
+    auto n = other.root_;
+    while(n->left)
+        n = n->left;
+    node* spare = nullptr;
+    auto const p = split_tree(
+        other.root_, n->seg.size(), spare);
+    other.root_ = nullptr;
+    BOOST_ASSERT(p.first == n);
+    root_ = join(root_, n, make_root(p.second));
+}
+
+rope
+rope::
+split(std::size_t n)
+{
+    rope rest;
+    if(n >= bytes(root_))
+        return rest;
+    if(n == 0)
+    {
+        std::swap(root_, rest.root_);
+        return rest;
+    }
+    tree_guard spare{ new node() };
+    auto const p = split_tree(root_, n, spare.n);
+    root_ = make_root(p.first);
+    rest.root_ = make_root(p.second);
+    return rest;
+}
+
+void
+rope::
+clear() noexcept
+{
+    destroy(root_);
+    root_ = nullptr;
+}
+
+void
+rope::
+do_slice(
+    slice_how how,
+    std::size_t n)
+{
+    auto const size = bytes(root_);
+    switch(how)
+    {
+    case slice_how::remove_prefix:
+        *this = split((std::min)(n, size));
+        return;
+
+    case slice_how::keep_prefix:
+        split(n);
+        return;
+
+    case slice_how::remove_suffix:
+        split(size - (std::min)(n, size));
+        return;
+
+    case slice_how::keep_suffix:
+        if(n < size)
+            *this = split(size - n);
+        return;
+    }
+}
+
+//------------------------------------------------
+
+auto
+rope_slice::
+begin() const noexcept ->
+    const_iterator
+{
+    if(size_ == 0)
+        return end();
+    return seek(pos_);
+}
+
+auto
+rope_slice::
+end() const noexcept ->
+    const_iterator
+{
+    // the first segment starting at
+    // or after the last byte
+    auto const last = pos_ + size_;
+    auto it = seek(last);
+    if(it.off_ < last)
+        ++it;
+    return it;
+}
+
+// Return an iterator to the segment holding
+// byte n, or the end if there is none
+auto
+rope_slice::
+seek(std::size_t n) const noexcept ->
+    const_iterator
+{
+    std::size_t off = 0;
+    auto t = root_;
+    while(t)
+    {
+        auto const lb = bytes(t->left);
+        auto const sb = t->seg.size();
+        if(n < lb)
+        {
+            t = t->left;
+            continue;
+        }
+        if(n < lb + sb)
+            break;
+        n -= lb + sb;
+        off += lb + sb;
+        t = t->right;
+    }
+    if(t)
+        off += bytes(t->left);
+    return const_iterator(
+        rope::const_iterator(root_, t), off, this);
+}
+
+} // buffers
+} // boost
@@ -0,0 +1,899 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+#include <boost/buffers/uring_read_source.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <boost/buffers/aligned_buffer.hpp>
+#include <boost/buffers/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+#include <vector>
+#include <sys/stat.h>
+
+#if defined(__linux__) && defined(__has_include)
+# if __has_include(<linux/io_uring.h>)
+#  include <linux/io_uring.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  if defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS)
+#   define BOOST_BUFFERS_HAS_IO_URING
+#  endif
+# endif
+#endif
+
+#include "detail/posix.hpp"
+
+namespace boost {
+namespace buffers {
+
+#ifdef BOOST_BUFFERS_HAS_IO_URING
+
+namespace detail {
+
+// The ring and the read-ahead blocks. Blocks are
+// submitted and consumed in round-robin order,
+// so the bytes of the file arrive in order.
+struct uring_state
+{
+    enum class slot_state
+    {
+        idle,       // not submitted
+        pending,    // in flight
+        ready       // completed, holds bytes
+    };
+
+    struct slot
+    {
+        slot_state state = slot_state::idle;
+        std::uint64_t off = 0;
+        std::size_t len = 0;
+        std::size_t filled = 0;
+        std::size_t pos = 0;
+    };
+
+    // A read straight into the caller's buffers
+    struct chunk
+    {
+        ::iovec* iov = nullptr;
+        std::size_t n = 0;
+        std::uint64_t off = 0;
+        std::size_t len = 0;
+        std::size_t filled = 0;
+    };
+
+    // user_data of cancellations
+    static constexpr std::uint64_t cancel_tag =
+        std::uint64_t(-1);
+
+    // user_data of chunk i is direct_tag + i
+    static constexpr std::uint64_t direct_tag =
+        std::uint64_t(1) << 32;
+
+    // iovecs of one request which are read directly
+    static constexpr std::size_t max_iov = 64;
+
+    int ring = -1;
+    int fd = -1;
+    bool seekable = false;
+    std::uint64_t size = 0;
+
+    void* sq_ptr = nullptr;
+    std::size_t sq_len = 0;
+    void* cq_ptr = nullptr;
+    std::size_t cq_len = 0;
+    ::io_uring_sqe* sqes = nullptr;
+    std::size_t sqes_len = 0;
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned sq_mask = 0;
+    unsigned sq_entries = 0;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned cq_mask = 0;
+    ::io_uring_cqe* cqes = nullptr;
+
+    bool fixed = false;
+    unsigned to_submit = 0;
+    std::size_t inflight = 0;
+
+    aligned_buffer mem;
+    std::size_t block = 0;
+    std::vector<slot> slots;
+    std::size_t head = 0;
+    std::uint64_t next_off = 0;
+    bool primed = false;
+    system::error_code ec;
+
+    std::vector<chunk> chunks;
+    ::iovec direct_iov[2 * max_iov];
+
+    ~uring_state()
+    {
+        drain();
+        if(sqes)
+            ::munmap(sqes, sqes_len);
+        if(cq_ptr && cq_ptr != sq_ptr)
+            ::munmap(cq_ptr, cq_len);
+        if(sq_ptr)
+            ::munmap(sq_ptr, sq_len);
+        if(ring != -1)
+            ::close(ring);
+    }
+
+    // Returns false if io_uring is unavailable
+    bool
+    setup(unsigned entries)
+    {
+        ::io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+        ring = static_cast<int>(::syscall(
+            __NR_io_uring_setup, entries, &p));
+        if(ring == -1)
+            return false;
+
+        // the read operations with an offset
+        // of -1 arrived in the same release
+        if(! (p.features & IORING_FEAT_RW_CUR_POS))
+            return false;
+
+        sq_len = p.sq_off.array +
+            p.sq_entries * sizeof(unsigned);
+        cq_len = p.cq_off.cqes +
+            p.cq_entries * sizeof(::io_uring_cqe);
+        bool const single =
+            (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if(single && cq_len > sq_len)
+            sq_len = cq_len;
+        sq_ptr = map(sq_len, IORING_OFF_SQ_RING);
+        if(! sq_ptr)
+            return false;
+        if(single)
+        {
+            cq_ptr = sq_ptr;
+        }
+        else
+        {
+            cq_ptr = map(cq_len, IORING_OFF_CQ_RING);
+            if(! cq_ptr)
+                return false;
+        }
+        sqes_len = p.sq_entries * sizeof(::io_uring_sqe);
+        sqes = static_cast<::io_uring_sqe*>(
+            map(sqes_len, IORING_OFF_SQES));
+        if(! sqes)
+            return false;
+
+        auto const sq = static_cast<unsigned char*>(sq_ptr);
+        auto const cq = static_cast<unsigned char*>(cq_ptr);
+        sq_head = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+        sq_tail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+        sq_array = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+        sq_mask = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+        sq_entries = p.sq_entries;
+        cq_head = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+        cq_mask = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+        cqes = reinterpret_cast<::io_uring_cqe*>(cq + p.cq_off.cqes);
+        return true;
+    }
+
+    void*
+    map(std::size_t len, off_t off) noexcept
+    {
+        void* const p = ::mmap(nullptr, len,
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            ring, off);
+        return p == MAP_FAILED ? nullptr : p;
+    }
+
+    // Register the blocks, so the kernel does not
+    // map them for every read. This fails when the
+    // locked memory limit is too low, in which case
+    // ordinary reads are used.
+    void
+    register_blocks() noexcept
+    {
+        ::iovec v;
+        v.iov_base = mem.data();
+        v.iov_len = mem.size();
+        fixed = ::syscall(__NR_io_uring_register, ring,
+            IORING_REGISTER_BUFFERS, &v, 1) == 0;
+    }
+
+    ::io_uring_sqe*
+    get_sqe() noexcept
+    {
+        // the kernel consumes every entry in
+        // io_uring_enter, so there is always room
+        unsigned const tail = *sq_tail;
+        BOOST_ASSERT(tail - __atomic_load_n(
+            sq_head, __ATOMIC_ACQUIRE) < sq_entries);
+        unsigned const i = tail & sq_mask;
+        auto const sqe = &sqes[i];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sq_array[i] = i;
+        return sqe;
+    }
+
+    void
+    push() noexcept
+    {
+        __atomic_store_n(sq_tail, *sq_tail + 1,
+            __ATOMIC_RELEASE);
+        ++to_submit;
+    }
+
+    unsigned char*
+    block_data(std::size_t i) noexcept
+    {
+        return static_cast<unsigned char*>(
+            mem.data()) + i * block;
+    }
+
+    // Queue the remainder of the read into slot i
+    void
+    submit(std::size_t i) noexcept
+    {
+        auto& s = slots[i];
+        auto const sqe = get_sqe();
+        sqe->opcode = static_cast<std::uint8_t>(fixed ?
+            IORING_OP_READ_FIXED : IORING_OP_READ);
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<std::uintptr_t>(
+            block_data(i) + s.filled);
+        sqe->len = static_cast<std::uint32_t>(
+            s.len - s.filled);
+        sqe->off = seekable ?
+            s.off + s.filled : std::uint64_t(-1);
+        sqe->buf_index = 0;
+        sqe->user_data = i;
+        s.state = slot_state::pending;
+        ++inflight;
+        push();
+    }
+
+    // Start a read of the next block into slot
+    // i, unless the end of the file is reached
+    void
+    start(std::size_t i) noexcept
+    {
+        auto& s = slots[i];
+        s.filled = 0;
+        s.pos = 0;
+        s.state = slot_state::idle;
+        if(seekable)
+        {
+            if(next_off >= size)
+                return;
+            auto const rest = size - next_off;
+            s.off = next_off;
+            s.len = rest < block ?
+                static_cast<std::size_t>(rest) : block;
+            next_off += s.len;
+        }
+        else
+        {
+            s.len = block;
+        }
+        submit(i);
+    }
+
+    // Queue the remainder of chunk i
+    void
+    submit_direct(std::size_t i) noexcept
+    {
+        auto& c = chunks[i];
+        auto const sqe = get_sqe();
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<std::uintptr_t>(c.iov);
+        sqe->len = static_cast<std::uint32_t>(c.n);
+        sqe->off = c.off + c.filled;
+        sqe->user_data = direct_tag + i;
+        ++inflight;
+        push();
+    }
+
+    void
+    cancel(std::size_t i) noexcept
+    {
+        auto const sqe = get_sqe();
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = i;
+        sqe->user_data = cancel_tag;
+        push();
+    }
+
+    // Submit queued entries, and optionally
+    // wait for at least one completion
+    int
+    enter(bool wait) noexcept
+    {
+        for(;;)
+        {
+            auto const r = ::syscall(__NR_io_uring_enter,
+                ring, to_submit, wait ? 1 : 0,
+                wait ? IORING_ENTER_GETEVENTS : 0,
+                nullptr, 0);
+            if(r >= 0)
+            {
+                to_submit -= static_cast<unsigned>(r);
+                return 0;
+            }
+            if(errno != EINTR)
+                return errno;
+        }
+    }
+
+    void
+    complete(
+        std::uint64_t user_data,
+        int res) noexcept
+    {
+        if(user_data == cancel_tag)
+            return;
+        if(user_data >= direct_tag)
+        {
+            complete_direct(static_cast<std::size_t>(
+                user_data - direct_tag), res);
+            return;
+        }
+        auto const i = static_cast<std::size_t>(user_data);
+        auto& s = slots[i];
+        --inflight;
+        if(res == -EINTR || res == -EAGAIN)
+        {
+            submit(i);
+            return;
+        }
+        s.state = slot_state::ready;
+        if(res < 0)
+        {
+            if(! ec.failed())
+                ec = system::error_code(
+                    -res, system::system_category());
+            return;
+        }
+        s.filled += static_cast<std::size_t>(res);
+
+        // a short read in the middle of a
+        // file is finished with another read
+        if( seekable &&
+            res > 0 &&
+            s.filled < s.len)
+            submit(i);
+    }
+
+    void
+    complete_direct(
+        std::size_t i,
+        int res) noexcept
+    {
+        auto& c = chunks[i];
+        --inflight;
+        if(res == -EINTR || res == -EAGAIN)
+        {
+            submit_direct(i);
+            return;
+        }
+        if(res < 0)
+        {
+            if(! ec.failed())
+                ec = system::error_code(
+                    -res, system::system_category());
+            return;
+        }
+        auto m = static_cast<std::size_t>(res);
+        c.filled += m;
+        while(m > 0)
+        {
+            if(m < c.iov->iov_len)
+            {
+                c.iov->iov_base = static_cast<
+                    unsigned char*>(c.iov->iov_base) + m;
+                c.iov->iov_len -= m;
+                break;
+            }
+            m -= c.iov->iov_len;
+            ++c.iov;
+            --c.n;
+        }
+        if(res > 0 && c.filled < c.len)
+            submit_direct(i);
+    }
+
+    void
+    reap() noexcept
+    {
+        unsigned h = *cq_head;
+        unsigned const t = __atomic_load_n(
+            cq_tail, __ATOMIC_ACQUIRE);
+        while(h != t)
+        {
+            auto const& cqe = cqes[h & cq_mask];
+            complete(cqe.user_data, cqe.res);
+            ++h;
+        }
+        __atomic_store_n(cq_head, h, __ATOMIC_RELEASE);
+    }
+
+    // Wait until slot i is no longer pending
+    void
+    wait(std::size_t i) noexcept
+    {
+        for(;;)
+        {
+            reap();
+            if(slots[i].state != slot_state::pending)
+                return;
+            auto const e = enter(true);
+            if(e != 0)
+            {
+                ec = system::error_code(
+                    e, system::system_category());
+                return;
+            }
+        }
+    }
+
+    // Cancel reads which may never complete,
+    // and wait for all reads in flight
+    void
+    drain() noexcept
+    {
+        if(ring == -1)
+            return;
+        if(! seekable)
+            for(std::size_t i = 0; i < slots.size(); ++i)
+                if(slots[i].state == slot_state::pending)
+                    cancel(i);
+        while(inflight > 0)
+        {
+            reap();
+            if(inflight == 0)
+                break;
+            if(enter(true) != 0)
+                break;
+        }
+    }
+
+    // Start reading ahead from the current
+    // position, beginning with the head slot
+    void
+    prime(std::uint64_t pos) noexcept
+    {
+        primed = true;
+        next_off = pos;
+        for(std::size_t i = 0; i < slots.size(); ++i)
+            start((head + i) % slots.size());
+    }
+
+    // Read want bytes at pos straight into the
+    // buffers, starting off bytes into iov[0].
+    // The bytes are split into reads of at least
+    // a block each, which are in flight together.
+    std::size_t
+    read_direct(
+        ::iovec const* iov,
+        std::size_t n,
+        std::size_t off,
+        std::uint64_t pos,
+        std::size_t want) noexcept
+    {
+        if(n > max_iov)
+        {
+            // the rest is read on the next call
+            std::size_t m = 0;
+            for(std::size_t k = 0; k < max_iov; ++k)
+                m += iov[k].iov_len;
+            n = max_iov;
+            if(want > m - off)
+                want = m - off;
+        }
+        auto count = want / block;
+        if(count > chunks.size())
+            count = chunks.size();
+        if(count < 1)
+            count = 1;
+        auto const each = want / count;
+        std::size_t j = 0;
+        std::size_t k = 0;
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            auto& c = chunks[i];
+            c.iov = direct_iov + j;
+            c.n = 0;
+            c.off = pos;
+            c.len = i + 1 < count ?
+                each : want - each * (count - 1);
+            c.filled = 0;
+            pos += c.len;
+            auto rest = c.len;
+            while(rest > 0)
+            {
+                BOOST_ASSERT(k < n);
+                auto const room = iov[k].iov_len - off;
+                auto const m = room < rest ? room : rest;
+                if(m > 0)
+                {
+                    direct_iov[j].iov_base = static_cast<
+                        unsigned char*>(iov[k].iov_base) + off;
+                    direct_iov[j].iov_len = m;
+                    ++j;
+                    ++c.n;
+                    rest -= m;
+                    off += m;
+                }
+                if(off == iov[k].iov_len)
+                {
+                    ++k;
+                    off = 0;
+                }
+            }
+            submit_direct(i);
+        }
+
+        // the kernel writes to the caller's
+        // buffers, so every read must finish
+        while(inflight > 0)
+        {
+            reap();
+            if(inflight == 0)
+                break;
+            auto const e = enter(true);
+            if(e != 0)
+            {
+                if(! ec.failed())
+                    ec = system::error_code(
+                        e, system::system_category());
+                break;
+            }
+        }
+
+        // only the bytes up to the first short
+        // read are contiguous with the position
+        std::size_t total = 0;
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            total += chunks[i].filled;
+            if(chunks[i].filled < chunks[i].len)
+                break;
+        }
+        return total;
+    }
+
+    // Return the number of bytes the buffers
+    // can hold, after skipping off bytes
+    std::size_t
+    wanted(
+        ::iovec const* iov,
+        std::size_t n,
+        std::size_t off,
+        std::uint64_t pos) const noexcept
+    {
+        std::size_t m = 0;
+        for(std::size_t k = 0; k < n; ++k)
+            m += iov[k].iov_len;
+        m -= off;
+        if(seekable && size - pos < m)
+            m = static_cast<std::size_t>(size - pos);
+        return m;
+    }
+
+    std::size_t
+    read(
+        ::iovec const* iov,
+        std::size_t n,
+        std::uint64_t& pos,
+        system::error_code& ec_out) noexcept
+    {
+        std::size_t total = 0;
+        std::size_t k = 0;
+        std::size_t off = 0;
+        while(k < n && ! ec.failed())
+        {
+            auto& s = slots[head];
+            if(! primed && s.state == slot_state::idle)
+            {
+                // nothing is read ahead, so a request of
+                // at least a block skips the copy
+                auto const want = wanted(
+                    iov + k, n - k, off, pos);
+                if(want == 0)
+                    break;
+                if(seekable && want >= block)
+                {
+                    auto const m = read_direct(
+                        iov + k, n - k, off, pos, want);
+                    total += m;
+                    pos += m;
+                    break;
+                }
+                prime(pos);
+            }
+            if(s.state == slot_state::pending)
+            {
+                // read ahead while waiting
+                wait(head);
+                if(ec.failed())
+                    break;
+            }
+            if(s.state == slot_state::idle ||
+                s.pos == s.filled)
+            {
+                // nothing more was read
+                ec_out = error::eof;
+                break;
+            }
+            auto const avail = s.filled - s.pos;
+            auto const room = iov[k].iov_len - off;
+            auto const m = avail < room ? avail : room;
+            std::memcpy(
+                static_cast<unsigned char*>(
+                    iov[k].iov_base) + off,
+                block_data(head) + s.pos, m);
+            s.pos += m;
+            off += m;
+            total += m;
+            pos += m;
+            if(off == iov[k].iov_len)
+            {
+                ++k;
+                off = 0;
+            }
+            if(s.pos == s.filled)
+            {
+                // stop reading ahead when the rest of
+                // the request can be read directly
+                if( primed &&
+                    seekable &&
+                    wanted(iov + k, n - k, off, pos) >= block)
+                    primed = false;
+                if(primed)
+                    start(head);
+                else
+                    s = slot();
+                head = (head + 1) % slots.size();
+
+                // a stream returns what is available,
+                // so the caller decides how long to wait
+                if(! seekable && total > 0)
+                    break;
+            }
+        }
+        if(ec.failed())
+            ec_out = ec;
+        else if(seekable && pos >= size)
+            ec_out = error::eof;
+
+        // let the kernel work ahead of the caller
+        if(to_submit > 0)
+            enter(false);
+        return total;
+    }
+};
+
+} // detail
+
+namespace {
+
+detail::uring_state*
+make_uring_state(
+    int fd,
+    bool seekable,
+    std::uint64_t size,
+    uring_read_source::options const& opt)
+{
+    std::size_t depth = opt.queue_depth;
+    if(depth < 1)
+        depth = 1;
+    if(depth > 64)
+        depth = 64;
+    if(! seekable)
+        depth = 1;
+    std::size_t block = opt.block_size;
+    if(block < 4096)
+        block = 4096;
+    if(block > (std::size_t(1) << 24))
+        block = std::size_t(1) << 24;
+    block = (block + 4095) & ~std::size_t(4095);
+
+    detail::uring_state* st = new detail::uring_state;
+    st->fd = fd;
+    st->seekable = seekable;
+    st->size = size;
+
+    // room for a cancellation of every read
+    if(! st->setup(static_cast<unsigned>(2 * depth)))
+    {
+        delete st;
+        return nullptr;
+    }
+    try
+    {
+        st->mem = aligned_buffer(depth * block);
+        st->block = block;
+        st->slots.resize(depth);
+        st->chunks.resize(depth);
+    }
+    catch(...)
+    {
+        delete st;
+        throw;
+    }
+    st->register_blocks();
+    return st;
+}
+
+} // (anon)
+
+#endif
+
+//------------------------------------------------
+
+uring_read_source::
+~uring_read_source()
+{
+#ifdef BOOST_BUFFERS_HAS_IO_URING
+    delete st_;
+#endif
+    if(fd_ != -1)
+        ::close(fd_);
+}
+
+uring_read_source::
+uring_read_source(
+    char const* path,
+    options const& opt)
+{
+    open(path);
+    detail::fd_guard fd{ fd_ };
+    init(opt, false);
+    fd.fd = -1;
+}
+
+uring_read_source::
+uring_read_source(
+    int fd,
+    options const& opt)
+    : fd_(fd)
+{
+    detail::fd_guard g{ fd };
+    init(opt, false);
+    g.fd = -1;
+}
+
+uring_read_source::
+uring_read_source(
+    char const* path,
+    options const& opt,
+    stream_t)
+{
+    open(path);
+    detail::fd_guard fd{ fd_ };
+    init(opt, true);
+    fd.fd = -1;
+}
+
+uring_read_source::
+uring_read_source(
+    int fd,
+    options const& opt,
+    stream_t)
+    : fd_(fd)
+{
+    detail::fd_guard g{ fd };
+    init(opt, true);
+    g.fd = -1;
+}
+
+void
+uring_read_source::
+open(char const* path)
+{
+    fd_ = ::open(path, O_RDONLY | O_CLOEXEC);
+    if(fd_ == -1)
+        detail::throw_system_error(detail::last_error());
+}
+
+void
+uring_read_source::
+init(
+    options const& opt,
+    bool stream)
+{
+    struct stat st;
+    if(::fstat(fd_, &st) == -1)
+        detail::throw_system_error(detail::last_error());
+    seekable_ = S_ISREG(st.st_mode);
+
+    // a stream has no size or offsets
+    if(! seekable_ && ! stream)
+        detail::throw_system_error(
+            system::errc::make_error_code(
+                system::errc::invalid_argument));
+    if(seekable_)
+        size_ = static_cast<std::uint64_t>(st.st_size);
+#ifdef BOOST_BUFFERS_HAS_IO_URING
+    if(opt.use_uring)
+        st_ = make_uring_state(fd_, seekable_, size_, opt);
+#else
+    (void)opt;
+#endif
+}
+
+void
+uring_read_source::
+rewind()
+{
+    if(fd_ == -1)
+        return;
+    BOOST_ASSERT(seekable_);
+    pos_ = 0;
+#ifdef BOOST_BUFFERS_HAS_IO_URING
+    if(st_)
+    {
+        st_->drain();
+        for(auto& s : st_->slots)
+            s = detail::uring_state::slot();
+        st_->head = 0;
+        st_->next_off = 0;
+        st_->primed = false;
+        st_->ec = {};
+    }
+#endif
+}
+
+std::size_t
+uring_read_source::
+do_read(
+    ::iovec const* iov,
+    std::size_t n,
+    system::error_code& ec)
+{
+    if(fd_ == -1 || (seekable_ && pos_ >= size_))
+    {
+        ec = error::eof;
+        return 0;
+    }
+    ec = {};
+#ifdef BOOST_BUFFERS_HAS_IO_URING
+    if(st_)
+        return st_->read(iov, n, pos_, ec);
+#endif
+    ssize_t result;
+    do
+    {
+        if(seekable_)
+            result = ::preadv(fd_, iov, static_cast<int>(n),
+                static_cast<off_t>(pos_));
+        else
+            result = ::readv(fd_, iov, static_cast<int>(n));
+    }
+    while(result == -1 && errno == EINTR);
+    if(result == -1)
+    {
+        ec = detail::last_error();
+        return 0;
+    }
+    auto const nread = static_cast<std::size_t>(result);
+    pos_ += nread;
+    if(nread == 0 || (seekable_ && pos_ >= size_))
+        ec = error::eof;
+    return nread;
+}
+
+} // buffers
+} // boost
+
+#endif
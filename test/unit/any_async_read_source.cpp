@@ -0,0 +1,385 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/any_async_read_source.hpp>
+
+#ifdef BOOST_BUFFERS_HAS_COROUTINES
+
+#include <boost/buffers/copy.hpp>
+#include <boost/buffers/slice.hpp>
+#include <boost/buffers/to_string.hpp>
+
+#include <boost/core/detail/static_assert.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+#include <deque>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace buffers {
+
+namespace {
+
+// resumes suspended coroutines on one thread
+struct scheduler
+{
+    std::deque<std::coroutine_handle<>> q;
+    std::size_t suspended = 0;
+    std::size_t max_suspended = 0;
+
+    void post(std::coroutine_handle<> h)
+    {
+        q.push_back(h);
+        if(++suspended > max_suspended)
+            max_suspended = suspended;
+    }
+
+    void run()
+    {
+        while(! q.empty())
+        {
+            auto const h = q.front();
+            q.pop_front();
+            --suspended;
+            h.resume();
+        }
+    }
+};
+
+// suspends each operation on the scheduler,
+// transferring at most chunk_ bytes
+struct test_source
+{
+    scheduler* sch_;
+    core::string_view s_;
+    std::size_t chunk_;
+    std::size_t nread_ = 0;
+
+    test_source(
+        scheduler& sch,
+        core::string_view s,
+        std::size_t chunk)
+        : sch_(&sch)
+        , s_(s)
+        , chunk_(chunk)
+    {
+    }
+
+    template<class MutableBufferSequence>
+    struct op
+    {
+        test_source* self;
+        MutableBufferSequence const* dest;
+        system::error_code* ec;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> h)
+        {
+            self->sch_->post(h);
+        }
+
+        std::size_t await_resume()
+        {
+            auto& s = *self;
+            if(s.nread_ >= s.s_.size())
+            {
+                *ec = error::eof;
+                return 0;
+            }
+            auto const n = copy(*dest, sans_prefix(
+                const_buffer(s.s_.data(), s.s_.size()),
+                    s.nread_), s.chunk_);
+            s.nread_ += n;
+            if(s.nread_ >= s.s_.size())
+                *ec = error::eof;
+            return n;
+        }
+    };
+
+    template<class MutableBufferSequence>
+    op<MutableBufferSequence>
+    read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        return { this, &dest, &ec };
+    }
+};
+
+// has_size, has_rewind
+struct test_source2 : test_source
+{
+    using test_source::test_source;
+
+    std::uint64_t
+    size() const noexcept
+    {
+        return s_.size();
+    }
+
+    void rewind()
+    {
+        nread_ = 0;
+    }
+};
+
+// an awaitable which is not an awaiter
+struct co_await_source
+{
+    test_source src_;
+
+    template<class MutableBufferSequence>
+    struct op
+    {
+        test_source::op<MutableBufferSequence> inner;
+
+        explicit op(
+            test_source::op<MutableBufferSequence> i)
+            : inner(i)
+        {
+        }
+
+        op(op const&) = delete;
+
+        test_source::op<MutableBufferSequence>
+        operator co_await() &&
+        {
+            return inner;
+        }
+    };
+
+    template<class MutableBufferSequence>
+    op<MutableBufferSequence>
+    read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        return op<MutableBufferSequence>(
+            src_.read(dest, ec));
+    }
+};
+
+// a coroutine which starts immediately
+// and destroys itself on completion
+struct task
+{
+    struct promise_type
+    {
+        task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+template<class MutableBufferSequence>
+task
+read_all(
+    any_async_read_source& src,
+    MutableBufferSequence const& dest,
+    std::string* out,
+    std::size_t* reads)
+{
+    for(;;)
+    {
+        system::error_code ec;
+        auto const n = co_await src.read(dest, ec);
+        ++*reads;
+        out->append(to_string(prefix(dest, n)));
+        if(ec.failed())
+        {
+            BOOST_TEST(ec == error::eof);
+            break;
+        }
+    }
+}
+
+task
+read_string(
+    any_async_read_source& src,
+    std::size_t k,
+    std::string* out)
+{
+    std::vector<char> buf(k);
+    for(;;)
+    {
+        system::error_code ec;
+        auto const n = co_await src.read(
+            mutable_buffer(buf.data(), k), ec);
+        out->append(buf.data(), n);
+        if(ec.failed())
+        {
+            BOOST_TEST(ec == error::eof);
+            break;
+        }
+    }
+}
+
+} // (anon)
+
+BOOST_CORE_STATIC_ASSERT(is_async_read_source<test_source>::value);
+BOOST_CORE_STATIC_ASSERT(is_async_read_source<co_await_source>::value);
+BOOST_CORE_STATIC_ASSERT(is_async_read_source<any_async_read_source>::value);
+
+struct any_async_read_source_test
+{
+    static
+    core::string_view
+    text()
+    {
+        return
+            "Not him old music think his found enjoy merry. Listening acuteness "
+            "dependent at or an. Apartments thoroughly unsatiable terminated "
+            "sex how themselves. She are ten hours wrong walls stand early.";
+    }
+
+    void
+    testMembers()
+    {
+        scheduler sch;
+        auto const s0 = text();
+        {
+            auto src = make_any_async_read_source(
+                test_source(sch, s0, 10));
+            any_async_read_source& ar = src;
+            BOOST_TEST(! ar.has_size());
+            BOOST_TEST(! ar.has_rewind());
+            BOOST_TEST_THROWS(ar.size(), std::invalid_argument);
+            BOOST_TEST_THROWS(ar.rewind(), std::invalid_argument);
+        }
+        {
+            auto src = make_any_async_read_source(
+                test_source2(sch, s0, 10));
+            any_async_read_source& ar = src;
+            BOOST_TEST(ar.has_size());
+            BOOST_TEST(ar.has_rewind());
+            BOOST_TEST_EQ(ar.size(), s0.size());
+            std::string s;
+            read_string(ar, 16, &s);
+            sch.run();
+            BOOST_TEST_EQ(s, s0);
+
+            // eof is reported again
+            {
+                s.clear();
+                read_string(ar, 16, &s);
+                sch.run();
+                BOOST_TEST(s.empty());
+            }
+
+            // until rewind
+            ar.rewind();
+            s.clear();
+            read_string(ar, 16, &s);
+            sch.run();
+            BOOST_TEST_EQ(s, s0);
+        }
+    }
+
+    void
+    testStreams()
+    {
+        // many streams make progress on one thread
+        scheduler sch;
+        auto const s0 = text();
+        constexpr std::size_t N = 8;
+        std::vector<std::unique_ptr<any_async_read_source>> v;
+        std::string s[N];
+        for(std::size_t i = 0; i < N; ++i)
+        {
+            using impl = detail::async_read_source_impl<test_source>;
+            v.emplace_back(new impl(
+                test_source(sch, s0, i + 1)));
+        }
+        for(std::size_t i = 0; i < N; ++i)
+            read_string(*v[i], 5, &s[i]);
+        BOOST_TEST_EQ(sch.max_suspended, N);
+        sch.run();
+        for(std::size_t i = 0; i < N; ++i)
+            BOOST_TEST_EQ(s[i], s0);
+    }
+
+    void
+    testSequences()
+    {
+        scheduler sch;
+        auto const s0 = text();
+        char buf[40];
+        std::vector<mutable_buffer> v;
+        for(std::size_t i = 0; i < sizeof(buf); ++i)
+            v.emplace_back(buf + i, 1);
+
+        // contiguous sequences are passed whole
+        {
+            auto src = make_any_async_read_source(
+                test_source(sch, s0, 1000));
+            std::string s;
+            std::size_t reads = 0;
+            read_all(src, v, &s, &reads);
+            sch.run();
+            BOOST_TEST_EQ(s, s0);
+            BOOST_TEST_EQ(reads,
+                (s0.size() + sizeof(buf) - 1) / sizeof(buf));
+        }
+
+        // other sequences are passed in batches
+        {
+            std::list<mutable_buffer> const ls(
+                v.begin(), v.end());
+            auto src = make_any_async_read_source(
+                test_source(sch, s0, 1000));
+            std::string s;
+            std::size_t reads = 0;
+            read_all(src, ls, &s, &reads);
+            sch.run();
+            BOOST_TEST_EQ(s, s0);
+            constexpr std::size_t B =
+                BOOST_BUFFERS_ANY_READ_SOURCE_BATCH;
+            BOOST_TEST_EQ(reads, (s0.size() + B - 1) / B);
+        }
+
+        // awaitables with operator co_await
+        {
+            auto src = make_any_async_read_source(
+                co_await_source{ test_source(sch, s0, 7) });
+            std::string s;
+            read_string(src, 16, &s);
+            sch.run();
+            BOOST_TEST_EQ(s, s0);
+        }
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testStreams();
+        testSequences();
+    }
+};
+
+TEST_SUITE(
+    any_async_read_source_test,
+    "boost.buffers.any_async_read_source");
+
+} // buffers
+} // boost
+
+#endif
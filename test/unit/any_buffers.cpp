@@ -11,13 +11,20 @@
 #include <boost/buffers/any_buffers.hpp>
 
 #include <boost/buffers/buffer_pair.hpp>
+#include <boost/buffers/copy.hpp>
 #include <boost/buffers/slice.hpp>
 #include <boost/buffers/to_string.hpp>
 
 #include <boost/core/detail/static_assert.hpp>
 #include <boost/core/detail/string_view.hpp>
 
-#include "test_suite.hpp"
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "test_buffers.hpp"
 
 namespace boost {
 namespace buffers {
@@ -29,12 +36,318 @@ BOOST_CORE_STATIC_ASSERT(  is_mutable_buffer_sequence<any_buffers<false>>::value
 
 namespace {
 
+// a sequence whose iterators may throw on copy,
+// so any_buffers stores them on the heap
+struct counted_buffers
+{
+    static std::size_t copies;
+
+    class const_iterator
+    {
+        const_buffer const* p_ = nullptr;
+
+    public:
+        using value_type = const_buffer;
+        using reference = const_buffer const&;
+        using pointer = const_buffer const*;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category =
+            std::bidirectional_iterator_tag;
+
+        const_iterator() = default;
+
+        explicit
+        const_iterator(
+            const_buffer const* p) noexcept
+            : p_(p)
+        {
+        }
+
+        const_iterator(
+            const_iterator const& other)
+            : p_(other.p_)
+        {
+            ++copies;
+        }
+
+        const_iterator&
+        operator=(
+            const_iterator const& other)
+        {
+            p_ = other.p_;
+            ++copies;
+            return *this;
+        }
+
+        reference operator*() const noexcept { return *p_; }
+        pointer operator->() const noexcept { return p_; }
+        const_iterator& operator++() noexcept { ++p_; return *this; }
+        const_iterator& operator--() noexcept { --p_; return *this; }
+        const_iterator operator++(int) { auto t = *this; ++p_; return t; }
+        const_iterator operator--(int) { auto t = *this; --p_; return t; }
+
+        bool operator==(const_iterator const& other) const noexcept
+        {
+            return p_ == other.p_;
+        }
+
+        bool operator!=(const_iterator const& other) const noexcept
+        {
+            return p_ != other.p_;
+        }
+    };
+
+    std::vector<const_buffer> v;
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(v.data());
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator(v.data() + v.size());
+    }
+};
+
+std::size_t counted_buffers::copies = 0;
+
+template<class It, class = void>
+struct has_jumps : std::false_type
+{
+};
+
+template<class It>
+struct has_jumps<It, decltype(void(
+    std::declval<It&>() += 1), void(
+    std::declval<It const&>() - std::declval<It const&>()), void(
+    std::declval<It const&>() < std::declval<It const&>()))>
+    : std::true_type
+{
+};
+
 } // (anon)
 
 struct any_buffers_test
 {
+    template<class BufferSequence>
+    static
+    void
+    check_random_access(
+        BufferSequence const& bs)
+    {
+        any_buffers<true, true> ab(bs);
+        auto const first = ab.begin();
+        auto const last = ab.end();
+        auto const n = static_cast<std::ptrdiff_t>(length(bs));
+        BOOST_TEST_EQ(std::distance(first, last), n);
+        BOOST_TEST_EQ(last - first, n);
+        BOOST_TEST_EQ(first - last, -n);
+        BOOST_TEST(first + n == last);
+        BOOST_TEST(last - n == first);
+        BOOST_TEST(n + first == last);
+        BOOST_TEST(first <= last);
+        BOOST_TEST(! (last < first));
+        auto it0 = buffers::begin(bs);
+        for(std::ptrdiff_t i = 0; i < n; ++i, ++it0)
+        {
+            const_buffer b0 = *it0;
+            const_buffer b1 = first[i];
+            BOOST_TEST_EQ(b0.data(), b1.data());
+            BOOST_TEST_EQ(b0.size(), b1.size());
+
+            auto it = first;
+            it += i;
+            BOOST_TEST(it - first == i);
+            BOOST_TEST(last - it == n - i);
+            BOOST_TEST(first < it || i == 0);
+            BOOST_TEST(it < last);
+            BOOST_TEST(it >= first);
+            it -= i;
+            BOOST_TEST(it == first);
+        }
+    }
+
+    void
+    testRandomAccess()
+    {
+        // random access only when requested
+        using bidi_iterator = any_buffers<true>::const_iterator;
+        using random_iterator = any_buffers<true, true>::const_iterator;
+        BOOST_CORE_STATIC_ASSERT(std::is_same<
+            std::iterator_traits<bidi_iterator>::iterator_category,
+            std::bidirectional_iterator_tag>::value);
+        BOOST_CORE_STATIC_ASSERT(std::is_same<
+            std::iterator_traits<random_iterator>::iterator_category,
+            std::random_access_iterator_tag>::value);
+        BOOST_CORE_STATIC_ASSERT(! has_jumps<bidi_iterator>::value);
+        BOOST_CORE_STATIC_ASSERT(has_jumps<random_iterator>::value);
+        BOOST_CORE_STATIC_ASSERT(std::is_same<
+            std::iterator_traits<any_buffers<false, true>::const_iterator
+                >::iterator_category,
+            std::random_access_iterator_tag>::value);
+
+        auto const& pat = test_pattern();
+        std::vector<const_buffer> v;
+        for(std::size_t i = 0; i < pat.size(); ++i)
+            v.emplace_back(&pat[i], 1);
+        std::list<const_buffer> l(v.begin(), v.end());
+
+        check_random_access(v);
+        check_random_access(const_buffer(pat.data(), pat.size()));
+
+        // any sequence is bidirectional
+        {
+            any_buffers<true> ab(l);
+            test::check_iterators(ab, pat);
+            BOOST_TEST_EQ(std::distance(
+                ab.begin(), ab.end()), pat.size());
+        }
+        {
+            slice_of<std::vector<const_buffer>> const bs(v);
+            any_buffers<true> ab(bs);
+            test::check_iterators(ab, pat);
+        }
+
+        // owning and random access
+        {
+            any_buffers_impl<std::vector<const_buffer>,
+                true, true> ab(v);
+            auto const first = ab.begin();
+            BOOST_TEST_EQ(ab.end() - first, pat.size());
+            BOOST_TEST_EQ(first[3].data(), &pat[3]);
+        }
+    }
+
+    template<class BufferSequence>
+    static
+    void
+    check_fetch(
+        BufferSequence const& bs)
+    {
+        any_buffers<true> ab(bs);
+        BOOST_TEST_EQ(size(ab), size(bs));
+        for(std::size_t n = 1; n <= 5; ++n)
+        {
+            std::string s;
+            std::size_t count = 0;
+            const_buffer v[5];
+            auto it = ab.begin();
+            for(;;)
+            {
+                auto const k = ab.fetch(it, v, n);
+                BOOST_TEST_LE(k, n);
+                for(std::size_t i = 0; i < k; ++i)
+                    s.append(static_cast<char const*>(
+                        v[i].data()), v[i].size());
+                count += k;
+                if(k < n)
+                    break;
+            }
+            BOOST_TEST(it == ab.end());
+            BOOST_TEST_EQ(count, length(bs));
+            BOOST_TEST_EQ(s, to_string(bs));
+            BOOST_TEST_EQ(ab.fetch(it, v, n), 0);
+        }
+    }
+
+    void
+    testFetch()
+    {
+        auto const& pat = test_pattern();
+        std::vector<const_buffer> v;
+        for(std::size_t i = 0; i < pat.size(); i += 3)
+            v.emplace_back(&pat[i], 3);
+        std::list<const_buffer> l(v.begin(), v.end());
+
+        check_fetch(v);
+        check_fetch(l);
+        check_fetch(const_buffer(pat.data(), pat.size()));
+        check_fetch(std::vector<const_buffer>());
+        check_fetch(slice_of<std::list<const_buffer>>(l));
+    }
+
+    void
+    testSize()
+    {
+        // size() does not copy heap-stored iterators
+        auto const& pat = test_pattern();
+        counted_buffers bs;
+        for(std::size_t i = 0; i < pat.size(); i += 3)
+            bs.v.emplace_back(&pat[i], 3);
+        any_buffers<true> ab(bs);
+        counted_buffers::copies = 0;
+        BOOST_TEST_EQ(size(ab), size(bs));
+        BOOST_TEST_EQ(counted_buffers::copies, 0);
+        BOOST_TEST_EQ(to_string(ab), pat);
+    }
+
+    void
+    testCopy()
+    {
+        // erased sequences are copied in batches
+        BOOST_CORE_STATIC_ASSERT(
+            detail::has_fetch<any_buffers<true>>::value);
+        BOOST_CORE_STATIC_ASSERT(
+            detail::has_fetch<any_buffers<false, true>>::value);
+        BOOST_CORE_STATIC_ASSERT(detail::has_fetch<
+            any_buffers_impl<std::vector<const_buffer>>>::value);
+        BOOST_CORE_STATIC_ASSERT(
+            ! detail::has_fetch<std::vector<const_buffer>>::value);
+
+        auto const& pat = test_pattern();
+        std::list<const_buffer> src;
+        for(std::size_t i = 0; i < pat.size(); ++i)
+            src.emplace_back(&pat[i], 1);
+        src.emplace_back();
+        std::string out(pat.size() + 5, '*');
+        std::list<mutable_buffer> dest;
+        for(std::size_t i = 0; i < out.size(); i += 3)
+        {
+            dest.emplace_back();
+            dest.emplace_back(&out[i],
+                (std::min)(std::size_t(3), out.size() - i));
+        }
+        any_buffers<true> const as(src);
+        any_buffers<false> const ad(dest);
+        for(std::size_t at_most = 0;
+            at_most <= pat.size() + 1; ++at_most)
+        {
+            std::string expect(out.size(), '*');
+            auto const n0 = (std::min)(at_most, pat.size());
+            expect.replace(0, n0, pat.substr(0, n0));
+
+            std::fill(out.begin(), out.end(), '*');
+            BOOST_TEST_EQ(copy(ad, as, at_most), n0);
+            BOOST_TEST_EQ(out, expect);
+
+            std::fill(out.begin(), out.end(), '*');
+            BOOST_TEST_EQ(copy(dest, as, at_most), n0);
+            BOOST_TEST_EQ(out, expect);
+
+            std::fill(out.begin(), out.end(), '*');
+            BOOST_TEST_EQ(copy(ad, src, at_most), n0);
+            BOOST_TEST_EQ(out, expect);
+        }
+
+        // the destination is smaller
+        {
+            char buf[10];
+            mutable_buffer mb(buf, sizeof(buf));
+            BOOST_TEST_EQ(copy(any_buffers<false>(mb), as),
+                sizeof(buf));
+            BOOST_TEST_EQ(core::string_view(buf, sizeof(buf)),
+                pat.substr(0, sizeof(buf)));
+        }
+    }
+
     void run()
     {
+        testRandomAccess();
+        testFetch();
+        testCopy();
+        testSize();
+
         core::string_view s0 = "Hello, world!";
         core::string_view s1 = "Goodbye, wg21!";
 
@@ -74,6 +387,33 @@ struct any_buffers_test
             BOOST_TEST_EQ(to_string(ab), to_string(bs));
             BOOST_TEST_EQ(to_string(make_any_buffers(bs)), to_string(bs));
         }
+
+        // many segments (big iterators)
+        {
+            auto const& pat = test_pattern();
+            std::list<const_buffer> v;
+            for(std::size_t i = 0; i < pat.size(); ++i)
+                v.emplace_back(&pat[i], 1);
+            slice_of<std::list<const_buffer>> cb(v);
+            any_buffers<true> ab(cb);
+            test::check_iterators(ab, pat);
+            BOOST_TEST_EQ(to_string(ab), pat);
+        }
+
+        // singular iterators
+        {
+            const_buffer_pair bs({{
+                { s0.data(), s0.size() },
+                { s1.data(), s1.size() } }});
+            slice_of<const_buffer_pair> cb(bs);
+            any_buffers<true> ab(cb);
+            any_buffers<true>::const_iterator it;
+            any_buffers<true>::const_iterator it2(it);
+            it = ab.begin();
+            BOOST_TEST(it == ab.begin());
+            it = it2;
+            BOOST_TEST(it != ab.begin());
+        }
     }
 };
 
@@ -18,6 +18,10 @@
 #include <boost/core/detail/static_assert.hpp>
 #include <boost/core/detail/string_view.hpp>
 
+#include <cstring>
+#include <list>
+#include <vector>
+
 #include "test_suite.hpp"
 
 namespace boost {
@@ -102,6 +106,45 @@ struct test_source4 : test_source3
     } 
 };
 
+// counts the calls to read
+struct counting_source : test_source
+{
+    std::size_t* calls_;
+
+    counting_source(
+        core::string_view s,
+        std::size_t* calls)
+        : test_source(s)
+        , calls_(calls)
+    {
+    }
+
+    template<class MutableBufferSequence>
+    std::size_t read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        ++*calls_;
+        return test_source::read(dest, ec);
+    }
+};
+
+// a buffer type derived from mutable_buffer,
+// which is larger than its base
+struct tagged_buffer : mutable_buffer
+{
+    int tag;
+
+    tagged_buffer(
+        void* data,
+        std::size_t size,
+        int tag_) noexcept
+        : mutable_buffer(data, size)
+        , tag(tag_)
+    {
+    }
+};
+
 // read from source into a string using a mutable buffers
 template<
     class ReadSource,
@@ -134,7 +177,8 @@ BOOST_CORE_STATIC_ASSERT(is_read_source<any_read_source>::value);
 
 struct any_read_source_test
 {
-    void run()
+    void
+    testRead()
     {
         core::string_view s0 = 
             "Not him old music think his found enjoy merry. Listening acuteness "
@@ -161,6 +205,103 @@ struct any_read_source_test
             BOOST_TEST_EQ(s1, s0);
         }
     }
+
+    void
+    testBatching()
+    {
+        core::string_view const s0 =
+            "0123456789abcdefghijklmnopqrstuvwxyzABCD";
+        constexpr std::size_t N = 40;
+        char buf[N];
+        std::vector<mutable_buffer> v;
+        for(std::size_t i = 0; i < N; ++i)
+            v.emplace_back(buf + i, 1);
+        BOOST_CORE_STATIC_ASSERT(
+            detail::is_contiguous_mutable_buffers<
+                std::vector<mutable_buffer>>::value);
+        BOOST_CORE_STATIC_ASSERT(
+            detail::is_contiguous_mutable_buffers<
+                span<mutable_buffer const>>::value);
+        BOOST_CORE_STATIC_ASSERT(
+            detail::is_contiguous_mutable_buffers<
+                mutable_buffer>::value);
+        BOOST_CORE_STATIC_ASSERT(
+            ! detail::is_contiguous_mutable_buffers<
+                std::list<mutable_buffer>>::value);
+        BOOST_CORE_STATIC_ASSERT(
+            ! detail::is_contiguous_mutable_buffers<
+                std::vector<tagged_buffer>>::value);
+        BOOST_CORE_STATIC_ASSERT(
+            ! detail::is_contiguous_mutable_buffers<
+                span<tagged_buffer const>>::value);
+
+        // contiguous sequences are read in one call
+        {
+            std::size_t calls = 0;
+            auto sr = make_any_read_source(
+                counting_source(s0, &calls));
+            system::error_code ec;
+            BOOST_TEST_EQ(sr.read(v, ec), N);
+            BOOST_TEST_EQ(calls, 1);
+            BOOST_TEST_EQ(core::string_view(buf, N), s0);
+        }
+        {
+            std::size_t calls = 0;
+            auto sr = make_any_read_source(
+                counting_source(s0, &calls));
+            system::error_code ec;
+            BOOST_TEST_EQ(sr.read(span<mutable_buffer const>(
+                v.data(), v.size()), ec), N);
+            BOOST_TEST_EQ(calls, 1);
+        }
+
+        // other sequences are read in batches
+        {
+            std::list<mutable_buffer> const ls(
+                v.begin(), v.end());
+            std::size_t calls = 0;
+            auto sr = make_any_read_source(
+                counting_source(s0, &calls));
+            system::error_code ec;
+            BOOST_TEST_EQ(sr.read(ls, ec), N);
+            BOOST_TEST_EQ(calls, (N +
+                BOOST_BUFFERS_ANY_READ_SOURCE_BATCH - 1) /
+                    BOOST_BUFFERS_ANY_READ_SOURCE_BATCH);
+            BOOST_TEST_EQ(core::string_view(buf, N), s0);
+        }
+
+        // arrays of derived buffers are copied
+        {
+            std::vector<tagged_buffer> tv;
+            for(std::size_t i = 0; i < N; ++i)
+                tv.emplace_back(buf + i, 1, -1);
+            std::memset(buf, 0, N);
+            std::size_t calls = 0;
+            auto sr = make_any_read_source(
+                counting_source(s0, &calls));
+            system::error_code ec;
+            BOOST_TEST_EQ(sr.read(tv, ec), N);
+            BOOST_TEST_EQ(core::string_view(buf, N), s0);
+        }
+
+        // empty sequences do not call the source
+        {
+            std::size_t calls = 0;
+            auto sr = make_any_read_source(
+                counting_source(s0, &calls));
+            system::error_code ec;
+            BOOST_TEST_EQ(sr.read(
+                std::vector<mutable_buffer>(), ec), 0);
+            BOOST_TEST_EQ(calls, 0);
+        }
+    }
+
+    void
+    run()
+    {
+        testRead();
+        testBatching();
+    }
 };
 
 TEST_SUITE(
@@ -13,6 +13,7 @@
 #include <boost/buffers/copy.hpp>
 #include <boost/buffers/dynamic_buffer.hpp>
 #include <boost/buffers/flat_buffer.hpp>
+#include <boost/buffers/shared_buffer.hpp>
 #include <boost/core/span.hpp>
 #include <boost/asio/buffer.hpp>
 #include <boost/core/detail/static_assert.hpp>
@@ -68,6 +69,8 @@ BOOST_CORE_STATIC_ASSERT(  asio::is_const_buffer_sequence<   const_buffer>::valu
 BOOST_CORE_STATIC_ASSERT(  asio::is_const_buffer_sequence<   const_buffer_pair>::value);
 BOOST_CORE_STATIC_ASSERT(  asio::is_const_buffer_sequence<   circular_buffer::const_buffers_type>::value);
 BOOST_CORE_STATIC_ASSERT(  asio::is_const_buffer_sequence<   flat_buffer::const_buffers_type>::value);
+BOOST_CORE_STATIC_ASSERT(  asio::is_const_buffer_sequence<   shared_buffer>::value);
+BOOST_CORE_STATIC_ASSERT(  asio::is_const_buffer_sequence<   shared_buffers>::value);
 BOOST_CORE_STATIC_ASSERT(  asio::is_const_buffer_sequence<   mutable_buffer>::value);
 BOOST_CORE_STATIC_ASSERT(  asio::is_const_buffer_sequence<   mutable_buffer_pair>::value);
 BOOST_CORE_STATIC_ASSERT(  asio::is_const_buffer_sequence<   circular_buffer::mutable_buffers_type>::value);
@@ -76,6 +79,8 @@ BOOST_CORE_STATIC_ASSERT(! asio::is_mutable_buffer_sequence< const_buffer>::valu
 BOOST_CORE_STATIC_ASSERT(! asio::is_mutable_buffer_sequence< const_buffer_pair>::value);
 BOOST_CORE_STATIC_ASSERT(! asio::is_mutable_buffer_sequence< circular_buffer::const_buffers_type>::value);
 BOOST_CORE_STATIC_ASSERT(! asio::is_mutable_buffer_sequence< flat_buffer::const_buffers_type>::value);
+BOOST_CORE_STATIC_ASSERT(! asio::is_mutable_buffer_sequence< shared_buffer>::value);
+BOOST_CORE_STATIC_ASSERT(! asio::is_mutable_buffer_sequence< shared_buffers>::value);
 BOOST_CORE_STATIC_ASSERT(  asio::is_mutable_buffer_sequence< mutable_buffer>::value);
 BOOST_CORE_STATIC_ASSERT(  asio::is_mutable_buffer_sequence< mutable_buffer_pair>::value);
 BOOST_CORE_STATIC_ASSERT(  asio::is_mutable_buffer_sequence< circular_buffer::mutable_buffers_type>::value);
@@ -0,0 +1,305 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/async_read_source.hpp>
+
+#ifdef BOOST_BUFFERS_HAS_COROUTINES
+
+#include <boost/buffers/copy.hpp>
+#include <boost/buffers/error.hpp>
+#include <boost/buffers/slice.hpp>
+
+#include <boost/core/detail/static_assert.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace buffers {
+
+namespace {
+
+struct test_source
+{
+    core::string_view s_;
+    std::size_t nread_ = 0;
+
+    explicit test_source(
+        core::string_view s)
+        : s_(s)
+    {
+    }
+
+    std::uint64_t
+    size() const noexcept
+    {
+        return s_.size();
+    }
+
+    void rewind()
+    {
+        nread_ = 0;
+    }
+
+    template<class MutableBufferSequence>
+    std::size_t read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        if(nread_ >= s_.size())
+        {
+            ec = error::eof;
+            return 0;
+        }
+        auto const n = copy(dest, sans_prefix(
+            const_buffer(s_.data(), s_.size()), nread_));
+        nread_ += n;
+        if(nread_ >= s_.size())
+            ec = error::eof;
+        return n;
+    }
+};
+
+// completes each operation on a new thread,
+// transferring at most chunk_ bytes
+struct threaded_source
+{
+    core::string_view s_;
+    std::size_t chunk_;
+    std::size_t nread_ = 0;
+    std::thread t_;
+
+    threaded_source(
+        core::string_view s,
+        std::size_t chunk)
+        : s_(s)
+        , chunk_(chunk)
+    {
+    }
+
+    threaded_source(threaded_source&& other) noexcept
+        : s_(other.s_)
+        , chunk_(other.chunk_)
+        , nread_(other.nread_)
+        , t_(std::move(other.t_))
+    {
+    }
+
+    ~threaded_source()
+    {
+        join();
+    }
+
+    void join()
+    {
+        if(t_.joinable())
+            t_.join();
+    }
+
+    template<class MutableBufferSequence>
+    struct op
+    {
+        threaded_source* self;
+        MutableBufferSequence const* dest;
+        system::error_code* ec;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> h)
+        {
+            self->join();
+            self->t_ = std::thread([h]{ h.resume(); });
+        }
+
+        std::size_t await_resume()
+        {
+            auto& s = *self;
+            if(s.nread_ >= s.s_.size())
+            {
+                *ec = error::eof;
+                return 0;
+            }
+            auto const n = copy(*dest, sans_prefix(
+                const_buffer(s.s_.data(), s.s_.size()),
+                    s.nread_), s.chunk_);
+            s.nread_ += n;
+            if(s.nread_ >= s.s_.size())
+                *ec = error::eof;
+            return n;
+        }
+    };
+
+    template<class MutableBufferSequence>
+    op<MutableBufferSequence>
+    read(
+        MutableBufferSequence const& dest,
+        system::error_code& ec)
+    {
+        return { this, &dest, &ec };
+    }
+};
+
+// a coroutine which starts immediately
+// and destroys itself on completion
+struct task
+{
+    struct promise_type
+    {
+        task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+template<class AsyncReadSource>
+task
+read_all(
+    AsyncReadSource& src,
+    std::size_t k,
+    std::string* out)
+{
+    std::vector<char> buf(k);
+    for(;;)
+    {
+        system::error_code ec;
+        auto const n = co_await src.read(
+            mutable_buffer(buf.data(), k), ec);
+        out->append(buf.data(), n);
+        if(ec.failed())
+        {
+            BOOST_TEST(ec == error::eof);
+            break;
+        }
+    }
+}
+
+} // (anon)
+
+BOOST_CORE_STATIC_ASSERT(! is_async_read_source<test_source>::value);
+BOOST_CORE_STATIC_ASSERT(is_async_read_source<threaded_source>::value);
+BOOST_CORE_STATIC_ASSERT(is_async_read_source<
+    async_read_source<test_source>>::value);
+BOOST_CORE_STATIC_ASSERT(has_size<
+    async_read_source<test_source>>::value);
+BOOST_CORE_STATIC_ASSERT(has_rewind<
+    async_read_source<test_source>>::value);
+BOOST_CORE_STATIC_ASSERT(is_read_source<
+    sync_read_source<threaded_source>>::value);
+BOOST_CORE_STATIC_ASSERT(! has_size<
+    sync_read_source<threaded_source>>::value);
+BOOST_CORE_STATIC_ASSERT(! has_rewind<
+    sync_read_source<threaded_source>>::value);
+
+struct async_read_source_test
+{
+    static
+    core::string_view
+    text()
+    {
+        return
+            "Not him old music think his found enjoy merry. Listening acuteness "
+            "dependent at or an. Apartments thoroughly unsatiable terminated "
+            "sex how themselves. She are ten hours wrong walls stand early.";
+    }
+
+    void
+    testAsyncReadSource()
+    {
+        auto const s0 = text();
+        for(std::size_t k : { 1, 7, 64, 1000 })
+        {
+            async_read_source src(test_source{s0});
+            BOOST_TEST_EQ(src.size(), s0.size());
+            std::string s;
+            read_all(src, k, &s);
+            BOOST_TEST_EQ(s, s0);
+
+            // rewind
+            src.rewind();
+            s.clear();
+            read_all(src, k, &s);
+            BOOST_TEST_EQ(s, s0);
+        }
+    }
+
+    void
+    testSyncReadSource()
+    {
+        auto const s0 = text();
+
+        // completes inline
+        {
+            sync_read_source src(
+                async_read_source(test_source{s0}));
+            BOOST_TEST_EQ(src.size(), s0.size());
+            char buf[10];
+            std::string s;
+            system::error_code ec;
+            do
+            {
+                auto const n = src.read(
+                    mutable_buffer(buf, sizeof(buf)), ec);
+                s.append(buf, n);
+            }
+            while(! ec.failed());
+            BOOST_TEST(ec == error::eof);
+            BOOST_TEST_EQ(s, s0);
+        }
+
+        // completes on another thread, filling
+        // the buffers over several operations
+        for(std::size_t chunk : { 1, 3, 1000 })
+        {
+            sync_read_source<threaded_source> src(
+                threaded_source(s0, chunk));
+            char buf[3][7];
+            std::vector<mutable_buffer> v;
+            for(auto& b : buf)
+                v.emplace_back(b, sizeof(b));
+            std::string s;
+            system::error_code ec;
+            do
+            {
+                auto const n = src.read(v, ec);
+                if(! ec.failed())
+                    BOOST_TEST_EQ(n, sizeof(buf));
+                s.append(buf[0], n);
+            }
+            while(! ec.failed());
+            BOOST_TEST(ec == error::eof);
+            BOOST_TEST_EQ(s, s0);
+        }
+    }
+
+    void
+    run()
+    {
+        testAsyncReadSource();
+        testSyncReadSource();
+    }
+};
+
+TEST_SUITE(
+    async_read_source_test,
+    "boost.buffers.async_read_source");
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,234 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/block_pool.hpp>
+
+#include <boost/buffers/growable_flat_buffer.hpp>
+#include <boost/buffers/segmented_buffer.hpp>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+namespace {
+
+// allocates from a pool as its thread exits,
+// after the thread's caches are destroyed
+struct exit_allocator
+{
+    block_pool* pool = nullptr;
+
+    ~exit_allocator()
+    {
+        if(! pool)
+            return;
+        void* p0 = pool->allocate();
+        void* p1 = pool->allocate();
+        pool->deallocate(p0);
+        pool->deallocate(p1);
+    }
+};
+
+thread_local exit_allocator tls_exit;
+
+} // (anon)
+
+struct block_pool_test
+{
+    void
+    testPool()
+    {
+        BOOST_TEST_THROWS(
+            block_pool(0),
+            std::invalid_argument);
+
+        // first allocation misses,
+        // reuse on the same thread hits
+        {
+            block_pool pool(64);
+            BOOST_TEST_EQ(pool.block_size(), 64);
+            void* p = pool.allocate();
+            auto st = pool.get_stats();
+            BOOST_TEST_EQ(st.hits, 0);
+            BOOST_TEST_EQ(st.misses, 1);
+            pool.deallocate(p);
+            BOOST_TEST_EQ(pool.get_stats().retained, 1);
+            void* p2 = pool.allocate();
+            BOOST_TEST_EQ(p2, p);
+            st = pool.get_stats();
+            BOOST_TEST_EQ(st.hits, 1);
+            BOOST_TEST_EQ(st.misses, 1);
+            BOOST_TEST_EQ(st.retained, 0);
+            pool.deallocate(p2);
+        }
+
+        // tiny blocks can hold the free list link
+        {
+            block_pool pool(1);
+            BOOST_TEST_GE(pool.block_size(), sizeof(void*));
+        }
+
+        // the retention cap bounds the free blocks
+        {
+            block_pool pool(16, 4, 8);
+            std::vector<void*> v;
+            for(int i = 0; i < 100; ++i)
+                v.push_back(pool.allocate());
+            for(auto p : v)
+                pool.deallocate(p);
+            auto const retained = pool.get_stats().retained;
+            BOOST_TEST_LE(retained, 4 + 8);
+            v.clear();
+            for(int i = 0; i < 12; ++i)
+                v.push_back(pool.allocate());
+            auto const st = pool.get_stats();
+            BOOST_TEST_EQ(st.hits, retained);
+            BOOST_TEST_EQ(st.misses, 100 + 12 - retained);
+            for(auto p : v)
+                pool.deallocate(p);
+
+            // trim releases everything
+            pool.trim();
+            BOOST_TEST_EQ(pool.get_stats().retained, 0);
+        }
+    }
+
+    void
+    testThreads()
+    {
+        block_pool pool(32, 256, 16);
+        std::vector<std::thread> threads;
+        for(int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&pool]
+            {
+                std::vector<void*> v;
+                for(int i = 0; i < 1000; ++i)
+                {
+                    for(int j = 0; j < 10; ++j)
+                        v.push_back(pool.allocate());
+                    for(auto p : v)
+                        pool.deallocate(p);
+                    v.clear();
+                }
+            });
+        }
+        for(auto& t : threads)
+            t.join();
+
+        // exited threads return their caches
+        auto const st = pool.get_stats();
+        BOOST_TEST_EQ(st.hits + st.misses, 4 * 1000 * 10);
+        BOOST_TEST_LE(st.misses, 4 * 10);
+        BOOST_TEST_LE(st.retained, 256);
+
+        // blocks freed by one thread are used by another
+        void* p = nullptr;
+        std::thread([&]{ p = pool.allocate(); }).join();
+        pool.deallocate(p);
+        std::thread([&]{ pool.deallocate(pool.allocate()); }).join();
+        BOOST_TEST_EQ(pool.get_stats().misses, st.misses);
+    }
+
+    void
+    testExiting()
+    {
+        block_pool pool(32, 256, 16);
+        std::thread([&pool]
+        {
+            // registered before the caches,
+            // so it is destroyed after them
+            tls_exit.pool = &pool;
+            pool.deallocate(pool.allocate());
+        }).join();
+
+        // one block from the depot, one new
+        auto const st = pool.get_stats();
+        BOOST_TEST_EQ(st.hits, 1);
+        BOOST_TEST_EQ(st.misses, 2);
+        BOOST_TEST_EQ(st.retained, 2);
+    }
+
+    void
+    testAllocator()
+    {
+        block_pool pool(4096 + 64);
+        using alloc = block_pool_allocator<unsigned char>;
+
+        // segmented_buffer blocks come from the pool
+        {
+            basic_segmented_buffer<alloc> b(4096, alloc(pool));
+            BOOST_TEST(b.get_allocator().pool().block_size() ==
+                pool.block_size());
+            for(int i = 0; i < 10; ++i)
+            {
+                b.commit(size(b.prepare(20000)));
+                b.consume(b.size());
+                b.shrink_to_fit();
+            }
+            auto const st = pool.get_stats();
+            BOOST_TEST_EQ(st.misses, 5);
+            BOOST_TEST_EQ(st.hits, 45);
+        }
+
+        // larger allocations bypass the pool
+        {
+            auto const misses = pool.get_stats().misses;
+            basic_growable_flat_buffer<alloc> b{alloc(pool)};
+            b.reserve(100);
+            b.reserve(100000);
+            BOOST_TEST_EQ(pool.get_stats().misses, misses);
+        }
+
+        // comparison
+        {
+            block_pool pool2(64);
+            BOOST_TEST(alloc(pool) == block_pool_allocator<int>(pool));
+            BOOST_TEST(alloc(pool) != alloc(pool2));
+        }
+
+#ifdef BOOST_BUFFERS_HAS_MEMORY_RESOURCE
+        // memory_resource
+        {
+            block_pool_resource mr(pool);
+            BOOST_TEST(mr.is_equal(mr));
+            BOOST_TEST(! mr.is_equal(
+                *std::pmr::new_delete_resource()));
+            auto const hits = pool.get_stats().hits;
+            void* p = mr.allocate(100);
+            mr.deallocate(p, 100);
+            void* q = mr.allocate(1 << 20);
+            mr.deallocate(q, 1 << 20);
+            BOOST_TEST_EQ(pool.get_stats().hits, hits + 1);
+        }
+#endif
+    }
+
+    void
+    run()
+    {
+        testPool();
+        testThreads();
+        testExiting();
+        testAllocator();
+    }
+};
+
+TEST_SUITE(
+    block_pool_test,
+    "boost.buffers.block_pool");
+
+} // buffers
+} // boost
@@ -11,6 +11,7 @@
 #include <boost/buffers/dynamic_buffer.hpp>
 
 #include <boost/buffers/circular_buffer.hpp>
+#include <boost/buffers/segmented_buffer.hpp>
 #include <boost/static_assert.hpp>
 #include "test_buffers.hpp"
 
@@ -73,10 +74,117 @@ struct any_dynamic_buffer_test
         }
     }
 
+    // counts the calls to data()
+    struct counting_buffer : circular_buffer
+    {
+        std::size_t* calls;
+
+        counting_buffer(
+            char* p,
+            std::size_t n,
+            std::size_t* calls_)
+            : circular_buffer(p, n)
+            , calls(calls_)
+        {
+        }
+
+        const_buffers_type
+        data() const noexcept
+        {
+            ++*calls;
+            return circular_buffer::data();
+        }
+    };
+
+    void
+    testLazy()
+    {
+        auto const& pat = test_pattern();
+        std::string s(pat.size(), 0);
+        std::size_t calls = 0;
+        any_dynamic_buffer_impl<counting_buffer> db(
+            counting_buffer(&s[0], s.size(), &calls));
+        any_dynamic_buffer& ab = db;
+
+        // mutations do not copy the sequence
+        for(std::size_t i = 0; i < pat.size(); ++i)
+            ab.commit(copy(ab.prepare(1),
+                make_buffer(&pat[i], 1)));
+        ab.consume(1);
+        BOOST_TEST_EQ(calls, 0);
+
+        // until it is observed
+        BOOST_TEST_EQ(test::make_string(
+            ab.data()), pat.substr(1));
+        BOOST_TEST_EQ(calls, 1);
+        BOOST_TEST_EQ(test::make_string(
+            ab.data()), pat.substr(1));
+        BOOST_TEST_EQ(calls, 1);
+        ab.consume(2);
+        BOOST_TEST_EQ(test::make_string(
+            ab.data()), pat.substr(3));
+        BOOST_TEST_EQ(calls, 2);
+
+        // modification through buffer()
+        db.buffer().consume(1);
+        BOOST_TEST_EQ(test::make_string(
+            ab.data()), pat.substr(4));
+        BOOST_TEST_EQ(calls, 3);
+    }
+
+    void
+    testSpill()
+    {
+        auto const& pat = test_pattern();
+
+        // bytes present before wrapping
+        {
+            segmented_buffer sb(2);
+            sb.commit(copy(sb.prepare(pat.size()),
+                make_buffer(pat.data(), pat.size())));
+            any_dynamic_buffer_impl<segmented_buffer, 4> db(
+                std::move(sb));
+            BOOST_TEST_EQ(test::make_string(
+                db.data()), pat);
+            test::check_sequence(db.data(), pat);
+            BOOST_TEST_GT(db.data().size(), 4);
+        }
+
+        // sequences longer than N are not truncated
+        for(std::size_t i = 0; i <= pat.size(); ++i)
+        {
+            any_dynamic_buffer_impl<segmented_buffer, 4> db(
+                segmented_buffer(2));
+            any_dynamic_buffer& ab = db;
+            auto const mb = ab.prepare(pat.size());
+            BOOST_TEST_EQ(buffers::size(mb), pat.size());
+            BOOST_TEST_GT(mb.size(), 4);
+            ab.commit(copy(mb,
+                make_buffer(pat.data(), pat.size())));
+            BOOST_TEST_EQ(test::make_string(
+                ab.data()), pat);
+            ab.consume(i);
+            BOOST_TEST_EQ(test::make_string(
+                ab.data()), pat.substr(i));
+            test::check_sequence(ab.data(), pat.substr(i));
+
+            // copies are independent
+            auto db2 = db;
+            db2.consume(1);
+            BOOST_TEST_EQ(test::make_string(
+                ab.data()), pat.substr(i));
+            if(i < pat.size())
+                BOOST_TEST_EQ(test::make_string(
+                    db2.data()), pat.substr(i + 1));
+        }
+    }
+
     void
     run()
     {
         testAny();
+        testLazy();
+        testSpill();
     }
 };
 
@@ -0,0 +1,281 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/file_read_source.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <boost/buffers/any_read_source.hpp>
+#include <boost/buffers/read_source.hpp>
+#include <boost/system/system_error.hpp>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+BOOST_STATIC_ASSERT(is_read_source<file_read_source>::value);
+BOOST_STATIC_ASSERT(has_size<file_read_source>::value);
+BOOST_STATIC_ASSERT(has_rewind<file_read_source>::value);
+BOOST_STATIC_ASSERT(is_mutable_buffer_sequence<aligned_buffer>::value);
+
+struct file_read_source_test
+{
+    static
+    std::string
+    make_contents(std::size_t n)
+    {
+        std::string s;
+        for(std::size_t i = 0; i < n; ++i)
+            s.push_back(static_cast<char>('a' + i % 26));
+        return s;
+    }
+
+    // Read the source into k-byte pieces
+    // scattered across 3-byte buffers
+    template<class Source>
+    static
+    std::string
+    read_all(
+        Source& src,
+        std::size_t k)
+    {
+        std::string s;
+        std::vector<char> buf(k);
+        std::vector<mutable_buffer> v;
+        for(std::size_t i = 0; i < k; i += 3)
+            v.emplace_back(&buf[i],
+                (std::min)(std::size_t(3), k - i));
+        for(;;)
+        {
+            system::error_code ec;
+            auto const n = src.read(v, ec);
+            s.append(buf.data(), n);
+            if(ec == error::eof)
+                break;
+            if(! BOOST_TEST(! ec.failed()))
+                break;
+            BOOST_TEST_EQ(n, k);
+        }
+        return s;
+    }
+
+    void
+    testAlignedBuffer()
+    {
+        {
+            aligned_buffer b;
+            BOOST_TEST_EQ(b.size(), 0);
+            BOOST_TEST_EQ(mutable_buffer(b).size(), 0);
+        }
+        {
+            aligned_buffer b(1);
+            BOOST_TEST_EQ(b.size(), 4096);
+            BOOST_TEST_EQ(reinterpret_cast<std::uintptr_t>(
+                b.data()) % 4096, 0);
+            std::memset(b.data(), 'x', b.size());
+        }
+        {
+            aligned_buffer b(100, 64);
+            BOOST_TEST_EQ(b.size(), 128);
+            BOOST_TEST_EQ(reinterpret_cast<std::uintptr_t>(
+                b.data()) % 64, 0);
+            auto const p = b.data();
+            aligned_buffer b1(std::move(b));
+            BOOST_TEST_EQ(b.size(), 0);
+            BOOST_TEST_EQ(b1.data(), p);
+            b = std::move(b1);
+            BOOST_TEST_EQ(b1.size(), 0);
+            BOOST_TEST_EQ(b.data(), p);
+            BOOST_TEST_EQ(mutable_buffer(b).data(), p);
+        }
+        BOOST_TEST_THROWS(
+            aligned_buffer(std::size_t(-1)),
+            std::length_error);
+    }
+
+    void
+    testRead()
+    {
+        auto const s = make_contents(10000);
+        test::temp_file const f(s);
+
+        // file_read_source()
+        {
+            file_read_source src;
+            BOOST_TEST_EQ(src.size(), 0);
+            char c;
+            system::error_code ec;
+            BOOST_TEST_EQ(src.read(
+                mutable_buffer(&c, 1), ec), 0);
+            BOOST_TEST(ec == error::eof);
+        }
+
+        // read
+        for(std::size_t k : { 1, 7, 100, 4096, 9999, 10000, 20000 })
+        {
+            file_read_source src(f.path.c_str());
+            BOOST_TEST_EQ(src.size(), s.size());
+            BOOST_TEST(read_all(src, k) == s);
+        }
+
+        // rewind
+        {
+            file_read_source src(f.path.c_str());
+            BOOST_TEST(read_all(src, 1000) == s);
+            char c;
+            system::error_code ec;
+            BOOST_TEST_EQ(src.read(
+                mutable_buffer(&c, 1), ec), 0);
+            BOOST_TEST(ec == error::eof);
+            src.rewind();
+            BOOST_TEST(read_all(src, 333) == s);
+        }
+
+        // more buffers than one batch
+        {
+            file_read_source src(f.path.c_str());
+            std::string in(s.size(), ' ');
+            std::vector<mutable_buffer> v;
+            for(std::size_t i = 0; i < in.size(); ++i)
+                v.emplace_back(&in[i], 1);
+            system::error_code ec;
+            BOOST_TEST_EQ(src.read(v, ec), s.size());
+            BOOST_TEST(ec == error::eof);
+            BOOST_TEST(in == s);
+        }
+
+        // any_read_source
+        {
+            auto src = make_any_read_source(
+                file_read_source(f.path.c_str()));
+            any_read_source& ar = src;
+            BOOST_TEST(ar.has_size());
+            BOOST_TEST(ar.has_rewind());
+            BOOST_TEST_EQ(ar.size(), s.size());
+            BOOST_TEST(read_all(ar, 123) == s);
+            ar.rewind();
+            BOOST_TEST(read_all(ar, 5000) == s);
+        }
+
+        // empty file
+        {
+            test::temp_file const e("");
+            file_read_source src(e.path.c_str());
+            BOOST_TEST_EQ(src.size(), 0);
+            BOOST_TEST(read_all(src, 10).empty());
+        }
+
+        // missing file
+        BOOST_TEST_THROWS(
+            file_read_source("/nonexistent/boost_buffers"),
+            system::system_error);
+
+        // a character device is not a regular file
+        BOOST_TEST_THROWS(
+            file_read_source("/dev/null"),
+            system::system_error);
+
+        // nor is a pipe
+        {
+            char dir[] = "/tmp/boost_buffers_XXXXXX";
+            if(BOOST_TEST(::mkdtemp(dir) != nullptr))
+            {
+                std::string const path =
+                    std::string(dir) + "/fifo";
+                BOOST_TEST_EQ(::mkfifo(path.c_str(), 0600), 0);
+
+                // opening blocks until both ends are open
+                std::thread t([&path]
+                {
+                    int const fd = ::open(
+                        path.c_str(), O_WRONLY);
+                    if(fd != -1)
+                        ::close(fd);
+                });
+                BOOST_TEST_THROWS(
+                    file_read_source(path.c_str()),
+                    system::system_error);
+                t.join();
+                ::unlink(path.c_str());
+                ::rmdir(dir);
+            }
+        }
+
+        // move
+        {
+            file_read_source src0(f.path.c_str());
+            file_read_source src1(std::move(src0));
+            BOOST_TEST_EQ(src0.size(), 0);
+            BOOST_TEST_EQ(src1.size(), s.size());
+            src0 = std::move(src1);
+            BOOST_TEST_EQ(src1.size(), 0);
+            BOOST_TEST(read_all(src0, 512) == s);
+        }
+    }
+
+    void
+    testDirect()
+    {
+        // not a multiple of the block size
+        auto const s = make_contents(3 * 4096 + 1000);
+        test::temp_file const f(s);
+        file_read_source::options opt;
+        opt.direct = true;
+        file_read_source src;
+        try
+        {
+            src = file_read_source(f.path.c_str(), opt);
+        }
+        catch(system::system_error const&)
+        {
+            // the file system does not
+            // support unbuffered I/O
+            return;
+        }
+        BOOST_TEST_EQ(src.size(), s.size());
+        aligned_buffer buf(8192);
+        std::string in;
+        system::error_code ec;
+        do
+        {
+            auto const n = src.read(buf, ec);
+            in.append(static_cast<char const*>(
+                buf.data()), n);
+        }
+        while(! ec.failed());
+        BOOST_TEST(ec == error::eof);
+        BOOST_TEST(in == s);
+    }
+
+    void
+    run()
+    {
+        testAlignedBuffer();
+        testRead();
+        testDirect();
+    }
+};
+
+TEST_SUITE(
+    file_read_source_test,
+    "boost.buffers.file_read_source");
+
+} // buffers
+} // boost
+
+#endif
@@ -179,11 +179,87 @@ struct flat_buffer_test
         }
     }
 
+    void
+    testCompact()
+    {
+        auto const& pat = test_pattern();
+
+        // compact()
+        {
+            std::string s(pat.size(), 0);
+            flat_buffer fb(&s[0], s.size());
+            BOOST_TEST_EQ(fb.compact(), 0);
+            fb.commit(copy(fb.prepare(pat.size()),
+                make_buffer(pat.data(), pat.size())));
+            fb.consume(10);
+            BOOST_TEST_EQ(fb.capacity(), 0);
+            BOOST_TEST_EQ(fb.compact(), pat.size() - 10);
+            BOOST_TEST_EQ(fb.capacity(), 10);
+            BOOST_TEST_EQ(fb.bytes_moved(), pat.size() - 10);
+            BOOST_TEST_EQ(test::make_string(
+                fb.data()), pat.substr(10));
+            BOOST_TEST_EQ(fb.compact(), 0);
+        }
+
+        // compact in prepare
+        {
+            std::string s(pat.size(), 0);
+            flat_buffer fb(&s[0], s.size());
+            fb.auto_compact(true);
+            fb.commit(copy(fb.prepare(pat.size()),
+                make_buffer(pat.data(), pat.size())));
+            fb.consume(10);
+            BOOST_TEST_EQ(fb.capacity(), 10);
+            BOOST_TEST_EQ(fb.bytes_moved(), 0);
+            fb.commit(copy(fb.prepare(10),
+                make_buffer(pat.data(), 10)));
+            BOOST_TEST_EQ(fb.bytes_moved(), pat.size() - 10);
+            BOOST_TEST_EQ(test::make_string(fb.data()),
+                pat.substr(10) + pat.substr(0, 10));
+            BOOST_TEST_THROWS(
+                fb.prepare(1),
+                std::invalid_argument);
+        }
+
+        // compact in consume
+        {
+            std::string s(pat.size(), 0);
+            flat_buffer fb(&s[0], s.size());
+            fb.auto_compact(true, 8);
+            fb.commit(copy(fb.prepare(pat.size()),
+                make_buffer(pat.data(), pat.size())));
+            fb.consume(5);
+            BOOST_TEST_EQ(fb.bytes_moved(), 0);
+            fb.consume(5);
+            BOOST_TEST_EQ(fb.bytes_moved(), pat.size() - 10);
+            BOOST_TEST_EQ(test::make_string(
+                fb.data()), pat.substr(10));
+            fb.consume(pat.size());
+            BOOST_TEST_EQ(fb.size(), 0);
+            BOOST_TEST_EQ(fb.bytes_moved(), pat.size() - 10);
+        }
+
+        // disabled
+        {
+            std::string s(pat.size(), 0);
+            flat_buffer fb(&s[0], s.size());
+            fb.auto_compact(true);
+            fb.auto_compact(false);
+            fb.commit(fb.prepare(pat.size()).size());
+            fb.consume(10);
+            BOOST_TEST_EQ(fb.capacity(), 0);
+            BOOST_TEST_THROWS(
+                fb.prepare(1),
+                std::invalid_argument);
+        }
+    }
+
     void
     run()
     {
         testMembers();
         testBuffer();
+        testCompact();
     }
 };
 
@@ -0,0 +1,286 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/growable_flat_buffer.hpp>
+
+#include <boost/buffers/copy.hpp>
+#include <boost/buffers/dynamic_buffer.hpp>
+#include <boost/buffers/make_buffer.hpp>
+#include <boost/static_assert.hpp>
+
+#include <stdexcept>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+BOOST_STATIC_ASSERT(is_dynamic_buffer<growable_flat_buffer>::value);
+BOOST_STATIC_ASSERT(std::is_same<
+    growable_flat_buffer::const_buffers_type, const_buffer>::value);
+BOOST_STATIC_ASSERT(std::is_nothrow_move_constructible<
+    growable_flat_buffer>::value);
+
+namespace {
+
+// An allocator which counts the bytes it has outstanding
+template<class T, class Propagate = std::false_type>
+struct counting_allocator
+{
+    using value_type = T;
+    using propagate_on_container_copy_assignment = Propagate;
+
+    std::size_t* used;
+
+    explicit
+    counting_allocator(
+        std::size_t* used_) noexcept
+        : used(used_)
+    {
+    }
+
+    template<class U>
+    counting_allocator(
+        counting_allocator<U, Propagate> const& other) noexcept
+        : used(other.used)
+    {
+    }
+
+    T*
+    allocate(std::size_t n)
+    {
+        *used += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void
+    deallocate(T* p, std::size_t n) noexcept
+    {
+        *used -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<class U>
+    bool
+    operator==(
+        counting_allocator<U, Propagate> const& other) const noexcept
+    {
+        return used == other.used;
+    }
+
+    template<class U>
+    bool
+    operator!=(
+        counting_allocator<U, Propagate> const& other) const noexcept
+    {
+        return used != other.used;
+    }
+};
+
+} // (anon)
+
+struct growable_flat_buffer_test
+{
+    static
+    void
+    append(
+        growable_flat_buffer& b,
+        core::string_view s)
+    {
+        b.commit(copy(
+            b.prepare(s.size()),
+            make_buffer(s.data(), s.size())));
+    }
+
+    void
+    testMembers()
+    {
+        auto const& pat = test_pattern();
+
+        // growable_flat_buffer()
+        {
+            growable_flat_buffer b;
+            BOOST_TEST_EQ(b.size(), 0);
+            BOOST_TEST_EQ(b.capacity(), 0);
+            BOOST_TEST_GT(b.max_size(), 0);
+        }
+
+        // growable_flat_buffer(std::size_t)
+        {
+            growable_flat_buffer b(10);
+            BOOST_TEST_EQ(b.max_size(), 10);
+            BOOST_TEST_NO_THROW(b.prepare(10));
+            BOOST_TEST_THROWS(
+                b.prepare(11),
+                std::length_error);
+            b.commit(4);
+            BOOST_TEST_THROWS(
+                b.prepare(7),
+                std::length_error);
+            BOOST_TEST_THROWS(
+                b.reserve(11),
+                std::length_error);
+        }
+
+        // prepare, commit, consume
+        {
+            growable_flat_buffer b;
+            append(b, pat);
+            BOOST_TEST_EQ(test::make_string(b.data()), pat);
+            b.consume(10);
+            BOOST_TEST_EQ(test::make_string(b.data()), pat.substr(10));
+            b.consume(pat.size());
+            BOOST_TEST_EQ(b.size(), 0);
+        }
+
+        // geometric growth
+        {
+            growable_flat_buffer b;
+            b.prepare(100);
+            b.commit(100);
+            auto const cap = b.capacity();
+            b.prepare(cap + 1);
+            BOOST_TEST_GE(b.size() + b.capacity(), 200);
+        }
+
+        // compact before reallocating
+        {
+            growable_flat_buffer b;
+            b.reserve(pat.size());
+            append(b, pat);
+            auto const p = b.data().data();
+            b.consume(10);
+            BOOST_TEST_EQ(b.capacity(), 10);
+            append(b, pat.substr(0, 10));
+            BOOST_TEST_EQ(b.data().data(), p);
+            BOOST_TEST_EQ(test::make_string(b.data()),
+                pat.substr(10) + pat.substr(0, 10));
+        }
+
+        // reserve, shrink_to_fit
+        {
+            growable_flat_buffer b;
+            b.reserve(100);
+            BOOST_TEST_EQ(b.capacity(), 100);
+            b.reserve(50);
+            BOOST_TEST_EQ(b.capacity(), 100);
+            append(b, "Hello, world!");
+            b.consume(7);
+            b.shrink_to_fit();
+            BOOST_TEST_EQ(b.capacity(), 0);
+            BOOST_TEST_EQ(test::make_string(b.data()), "world!");
+            b.consume(6);
+            b.shrink_to_fit();
+            BOOST_TEST_EQ(b.capacity(), 0);
+            BOOST_TEST_EQ(b.size(), 0);
+        }
+
+        // copy and move
+        {
+            growable_flat_buffer b0;
+            append(b0, pat);
+            b0.consume(5);
+            growable_flat_buffer b1(b0);
+            BOOST_TEST_EQ(test::make_string(b1.data()), pat.substr(5));
+            growable_flat_buffer b2;
+            b2 = b0;
+            BOOST_TEST_EQ(test::make_string(b2.data()), pat.substr(5));
+            growable_flat_buffer b3(std::move(b1));
+            BOOST_TEST_EQ(test::make_string(b3.data()), pat.substr(5));
+            BOOST_TEST_EQ(b1.size(), 0);
+            b2 = std::move(b3);
+            BOOST_TEST_EQ(test::make_string(b2.data()), pat.substr(5));
+            BOOST_TEST_EQ(b3.size(), 0);
+            b0.clear();
+            BOOST_TEST_EQ(b0.size(), 0);
+        }
+    }
+
+    void
+    testAllocator()
+    {
+        using alloc = counting_allocator<char>;
+        std::size_t used0 = 0;
+        std::size_t used1 = 0;
+        {
+            basic_growable_flat_buffer<alloc> b0{alloc(&used0)};
+            b0.prepare(100);
+            b0.commit(100);
+            BOOST_TEST_EQ(used0, 100);
+            BOOST_TEST(b0.get_allocator() == alloc(&used0));
+
+            // unequal allocators copy the bytes
+            basic_growable_flat_buffer<alloc> b1{alloc(&used1)};
+            b1 = std::move(b0);
+            BOOST_TEST_EQ(b1.size(), 100);
+            BOOST_TEST_EQ(b0.size(), 0);
+            BOOST_TEST_EQ(used1, 100);
+            b0.shrink_to_fit();
+            BOOST_TEST_EQ(used0, 0);
+
+            // equal allocators transfer the storage
+            basic_growable_flat_buffer<alloc> b2{alloc(&used1)};
+            b2 = std::move(b1);
+            BOOST_TEST_EQ(b2.size(), 100);
+            BOOST_TEST_EQ(used1, 100);
+        }
+        BOOST_TEST_EQ(used0, 0);
+        BOOST_TEST_EQ(used1, 0);
+
+        // copy assignment keeps the allocator
+        {
+            basic_growable_flat_buffer<alloc> b0{alloc(&used0)};
+            basic_growable_flat_buffer<alloc> b1{alloc(&used1)};
+            b0.prepare(100);
+            b0.commit(100);
+            b1.prepare(10);
+            b1 = b0;
+            BOOST_TEST_EQ(b1.size(), 100);
+            BOOST_TEST(b1.get_allocator() == alloc(&used1));
+            BOOST_TEST_EQ(used0, 100);
+            BOOST_TEST_EQ(used1, 100);
+        }
+        BOOST_TEST_EQ(used0, 0);
+        BOOST_TEST_EQ(used1, 0);
+
+        // copy assignment propagates the allocator
+        {
+            using palloc = counting_allocator<
+                char, std::true_type>;
+            basic_growable_flat_buffer<palloc> b0{palloc(&used0)};
+            basic_growable_flat_buffer<palloc> b1{palloc(&used1)};
+            b0.prepare(100);
+            b0.commit(100);
+            b1.prepare(10);
+            BOOST_TEST_EQ(used1, 10);
+            b1 = b0;
+            BOOST_TEST_EQ(b1.size(), 100);
+            BOOST_TEST(b1.get_allocator() == palloc(&used0));
+            BOOST_TEST_EQ(used0, 200);
+            BOOST_TEST_EQ(used1, 0);
+        }
+        BOOST_TEST_EQ(used0, 0);
+        BOOST_TEST_EQ(used1, 0);
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testAllocator();
+    }
+};
+
+TEST_SUITE(
+    growable_flat_buffer_test,
+    "boost.buffers.growable_flat_buffer");
+
+} // buffers
+} // boost
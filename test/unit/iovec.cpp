@@ -0,0 +1,218 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/iovec.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <boost/buffers/buffer_pair.hpp>
+#include <boost/buffers/make_buffer.hpp>
+#include <boost/buffers/slice.hpp>
+
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+struct iovec_test
+{
+    // Return the bytes of a batch
+    static
+    std::string
+    to_string(span<::iovec const> v)
+    {
+        std::string s;
+        for(auto const& e : v)
+            s.append(static_cast<char const*>(
+                e.iov_base), e.iov_len);
+        return s;
+    }
+
+    // Visit the sequence with batches of at most
+    // n elements, consuming k bytes at a time
+    template<class BufferSequence>
+    static
+    void
+    check(
+        BufferSequence const& bs,
+        core::string_view pat)
+    {
+        for(std::size_t n = 1; n <= 4; ++n)
+        for(std::size_t k = 1; k <= pat.size() + 1; ++k)
+        {
+            ::iovec v[4];
+            iovec_cursor<BufferSequence> c(bs);
+            std::string s;
+            while(! c.empty())
+            {
+                auto const iov = c.prepare(v, n);
+                BOOST_TEST_GT(iov.size(), 0);
+                BOOST_TEST_LE(iov.size(), n);
+                BOOST_TEST_GT(iov[0].iov_len, 0);
+                auto const b = to_string(iov).substr(0, k);
+                s.append(b);
+                c.consume(b.size());
+            }
+            BOOST_TEST(c.prepare(v, n).empty());
+            BOOST_TEST_EQ(s, pat);
+        }
+    }
+
+    void
+    testSequences()
+    {
+        auto const& pat = test_pattern();
+        std::vector<const_buffer> v;
+        v.emplace_back();
+        for(std::size_t i = 0; i < pat.size(); i += 3)
+        {
+            v.emplace_back(pat.data() + i,
+                (std::min)(std::size_t(3), pat.size() - i));
+            v.emplace_back();
+        }
+
+        // generic
+        check(v, pat);
+
+        // span
+        span<const_buffer const> const sp(v.data(), v.size());
+        check(sp, pat);
+
+        // slice_of
+        auto const sl = prefix(v, pat.size() - 2);
+        check(sl, pat.substr(0, pat.size() - 2));
+
+        // any_buffers
+        any_const_buffers const ab(v);
+        check(ab, pat);
+
+        // single buffer
+        auto const cb = make_buffer(pat.data(), pat.size());
+        check(cb, pat);
+
+        // buffer pair
+        const_buffer_pair const bp{{
+            make_buffer(pat.data(), 4),
+            make_buffer(pat.data() + 4, pat.size() - 4) }};
+        check(bp, pat);
+
+        // empty sequence
+        {
+            std::vector<const_buffer> e(3);
+            iovec_cursor<std::vector<const_buffer>> c(e);
+            BOOST_TEST(c.empty());
+        }
+    }
+
+    void
+    testDirect()
+    {
+        auto const& pat = test_pattern();
+        const_buffer v[3] = {
+            make_buffer(pat.data(), 2),
+            make_buffer(pat.data() + 2, 3),
+            make_buffer(pat.data() + 5, pat.size() - 5) };
+        span<const_buffer const> const sp(v, 3);
+        iovec_cursor<span<const_buffer const>> c(sp);
+        ::iovec dest[3];
+
+        // the elements are used in place
+        auto iov = c.prepare(dest, 3);
+        BOOST_TEST_EQ(iov.size(), 3);
+        BOOST_TEST(static_cast<void const*>(iov.data()) ==
+            static_cast<void const*>(v));
+        BOOST_TEST_EQ(to_string(iov), pat);
+
+        // until a buffer is partly consumed
+        c.consume(1);
+        iov = c.prepare(dest, 2);
+        BOOST_TEST(iov.data() == dest);
+        BOOST_TEST_EQ(to_string(iov), pat.substr(1, 4));
+        c.consume(1);
+        iov = c.prepare(dest, 3);
+        BOOST_TEST(static_cast<void const*>(iov.data()) ==
+            static_cast<void const*>(&v[1]));
+    }
+
+    void
+    testSystemCalls()
+    {
+        // more segments than one call accepts
+        std::size_t const count = iov_max + iov_max / 2 + 1;
+        std::string out(count, ' ');
+        for(std::size_t i = 0; i < count; ++i)
+            out[i] = static_cast<char>('a' + i % 26);
+        std::vector<const_buffer> wv;
+        for(std::size_t i = 0; i < count; ++i)
+            wv.emplace_back(&out[i], 1);
+
+        int fd[2];
+        if(! BOOST_TEST_EQ(::pipe(fd), 0))
+            return;
+        ::iovec v[iov_max];
+        std::size_t calls = 0;
+        {
+            iovec_cursor<std::vector<const_buffer>> c(wv);
+            while(! c.empty())
+            {
+                auto const iov = c.prepare(v, iov_max);
+                auto const n = ::writev(fd[1], iov.data(),
+                    static_cast<int>(iov.size()));
+                if(! BOOST_TEST_GT(n, 0))
+                    break;
+                c.consume(static_cast<std::size_t>(n));
+                ++calls;
+            }
+        }
+        BOOST_TEST_GE(calls, 2);
+
+        std::string in(count, ' ');
+        std::vector<mutable_buffer> rv;
+        for(std::size_t i = 0; i < count; i += 3)
+            rv.emplace_back(&in[i],
+                (std::min)(std::size_t(3), count - i));
+        {
+            iovec_cursor<std::vector<mutable_buffer>> c(rv);
+            while(! c.empty())
+            {
+                auto const iov = c.prepare(v, iov_max);
+                auto const n = ::readv(fd[0], iov.data(),
+                    static_cast<int>(iov.size()));
+                if(! BOOST_TEST_GT(n, 0))
+                    break;
+                c.consume(static_cast<std::size_t>(n));
+            }
+        }
+        BOOST_TEST(in == out);
+        ::close(fd[0]);
+        ::close(fd[1]);
+    }
+
+    void
+    run()
+    {
+        testSequences();
+        testDirect();
+        testSystemCalls();
+    }
+};
+
+TEST_SUITE(
+    iovec_test,
+    "boost.buffers.iovec");
+
+} // buffers
+} // boost
+
+#endif
@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/mapped_file_source.hpp>
+
+#include <boost/buffers/data_source.hpp>
+#include <boost/system/system_error.hpp>
+#include <cstdio>
+#include <string>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+BOOST_STATIC_ASSERT(is_data_source<mapped_file_source>::value);
+BOOST_STATIC_ASSERT(! std::is_copy_constructible<
+    mapped_file_source>::value);
+
+struct mapped_file_source_test
+{
+#ifdef BOOST_HAS_UNISTD_H
+    static
+    std::string
+    to_string(mapped_file_source const& m)
+    {
+        return std::string(static_cast<char const*>(
+            m.data().data()), m.size());
+    }
+#endif
+
+    void
+    testMembers()
+    {
+        // mapped_file_source()
+        {
+            mapped_file_source m;
+            BOOST_TEST_EQ(m.size(), 0);
+            BOOST_TEST_EQ(m.data().size(), 0);
+            m.advise(mapped_file_source::advice::willneed);
+        }
+
+#ifdef BOOST_HAS_UNISTD_H
+        // larger than a page, so that
+        // ranges may start anywhere
+        std::string s;
+        for(std::size_t i = 0; i < 10000; ++i)
+            s.push_back(static_cast<char>('a' + i % 26));
+        test::temp_file const f(s);
+
+        // mapped_file_source(char const*)
+        {
+            mapped_file_source m(f.path.c_str());
+            BOOST_TEST_EQ(m.size(), s.size());
+            BOOST_TEST(to_string(m) == s);
+        }
+
+        // mapped_file_source(char const*, std::uint64_t, std::size_t)
+        {
+            for(std::size_t off : { 0, 1, 4095, 4096, 4097, 9999 })
+            {
+                mapped_file_source m(f.path.c_str(), off, 100);
+                BOOST_TEST(to_string(m) == s.substr(off, 100));
+            }
+            BOOST_TEST_EQ(mapped_file_source(
+                f.path.c_str(), 9990, 100).size(), 10);
+            BOOST_TEST_EQ(mapped_file_source(
+                f.path.c_str(), 10000, 100).size(), 0);
+            BOOST_TEST_EQ(mapped_file_source(
+                f.path.c_str(), 5, 0).size(), 0);
+        }
+
+        // options
+        {
+            mapped_file_source::options opt;
+            opt.hint = mapped_file_source::advice::sequential;
+            opt.huge_pages = true;
+            mapped_file_source m(f.path.c_str(), 4097, 5000, opt);
+            BOOST_TEST(to_string(m) == s.substr(4097, 5000));
+            m.advise(mapped_file_source::advice::random);
+            m.advise(mapped_file_source::advice::willneed);
+            m.advise(mapped_file_source::advice::normal);
+            BOOST_TEST(to_string(m) == s.substr(4097, 5000));
+        }
+
+        // empty file
+        {
+            test::temp_file const e("");
+            mapped_file_source m(e.path.c_str());
+            BOOST_TEST_EQ(m.size(), 0);
+        }
+
+        // missing file
+        BOOST_TEST_THROWS(
+            mapped_file_source("/nonexistent/boost_buffers"),
+            system::system_error);
+
+        // move
+        {
+            mapped_file_source m0(f.path.c_str());
+            auto const p = m0.data().data();
+            mapped_file_source m1(std::move(m0));
+            BOOST_TEST_EQ(m0.size(), 0);
+            BOOST_TEST_EQ(m1.data().data(), p);
+            m0 = std::move(m1);
+            BOOST_TEST_EQ(m1.size(), 0);
+            BOOST_TEST(to_string(m0) == s);
+            m0 = mapped_file_source();
+            BOOST_TEST_EQ(m0.size(), 0);
+        }
+
+        // the mapping outlives the file name
+        {
+            mapped_file_source m;
+            {
+                test::temp_file const g("hello");
+                m = mapped_file_source(g.path.c_str());
+            }
+            BOOST_TEST(to_string(m) == "hello");
+        }
+#else
+        BOOST_TEST_THROWS(
+            mapped_file_source("file"),
+            system::system_error);
+#endif
+    }
+
+    void
+    run()
+    {
+        testMembers();
+    }
+};
+
+TEST_SUITE(
+    mapped_file_source_test,
+    "boost.buffers.mapped_file_source");
+
+} // buffers
+} // boost
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/mirrored_buffer.hpp>
+
+#include <boost/buffers/copy.hpp>
+#include <boost/buffers/dynamic_buffer.hpp>
+#include <boost/buffers/make_buffer.hpp>
+#include <boost/system/system_error.hpp>
+#include <cstring>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+BOOST_STATIC_ASSERT(is_dynamic_buffer<mirrored_buffer>::value);
+BOOST_STATIC_ASSERT(std::is_same<
+    mirrored_buffer::const_buffers_type, const_buffer>::value);
+BOOST_STATIC_ASSERT(std::is_same<
+    mirrored_buffer::mutable_buffers_type, mutable_buffer>::value);
+BOOST_STATIC_ASSERT(! std::is_copy_constructible<
+    mirrored_buffer>::value);
+
+struct mirrored_buffer_test
+{
+    static
+    void
+    append(
+        mirrored_buffer& b,
+        core::string_view s)
+    {
+        b.commit(copy(
+            b.prepare(s.size()),
+            make_buffer(s.data(), s.size())));
+    }
+
+    void
+    testMembers()
+    {
+        // mirrored_buffer()
+        {
+            mirrored_buffer b;
+            BOOST_TEST_EQ(b.size(), 0);
+            BOOST_TEST_EQ(b.max_size(), 0);
+            BOOST_TEST_EQ(b.data().size(), 0);
+            BOOST_TEST_THROWS(
+                b.prepare(1),
+                std::length_error);
+        }
+
+#ifdef __linux__
+        // mirrored_buffer(std::size_t)
+        {
+            mirrored_buffer b(1);
+            BOOST_TEST_GE(b.max_size(), 1);
+            BOOST_TEST_EQ(b.capacity(), b.max_size());
+            BOOST_TEST_THROWS(
+                b.prepare(b.max_size() + 1),
+                std::length_error);
+            mirrored_buffer b0(0);
+            BOOST_TEST_EQ(b0.max_size(), b.max_size());
+            BOOST_TEST_THROWS(
+                mirrored_buffer(std::size_t(-1)),
+                std::length_error);
+        }
+
+        // mirrored_buffer(mirrored_buffer&&)
+        // operator=(mirrored_buffer&&)
+        {
+            mirrored_buffer b0(1);
+            append(b0, "Hello");
+            auto const cap = b0.max_size();
+            mirrored_buffer b1(std::move(b0));
+            BOOST_TEST_EQ(b0.max_size(), 0);
+            BOOST_TEST_EQ(b0.size(), 0);
+            BOOST_TEST_EQ(b1.max_size(), cap);
+            BOOST_TEST_EQ(test::make_string(b1.data()), "Hello");
+            mirrored_buffer b2(1);
+            b2 = std::move(b1);
+            BOOST_TEST_EQ(b1.max_size(), 0);
+            BOOST_TEST_EQ(test::make_string(b2.data()), "Hello");
+        }
+#else
+        BOOST_TEST_THROWS(
+            mirrored_buffer(1),
+            system::system_error);
+#endif
+    }
+
+    void
+    testWrap()
+    {
+#ifdef __linux__
+        auto const& pat = test_pattern();
+        mirrored_buffer b(1);
+        auto const cap = b.max_size();
+
+        // every window is contiguous, including
+        // those which straddle the end of storage
+        for(std::size_t i = 0; i <= pat.size(); ++i)
+        {
+            b.consume(b.size());
+            b.prepare(cap - i);
+            b.commit(cap - i);
+            b.consume(cap - i);
+            append(b, pat);
+            auto const d = b.data();
+            BOOST_TEST_EQ(d.size(), pat.size());
+            BOOST_TEST_EQ(test::make_string(d), pat);
+            test::check_sequence(d, pat);
+        }
+
+        // the same bytes are visible at the
+        // start of the storage
+        {
+            b.consume(b.size());
+            b.prepare(cap - 4);
+            b.commit(cap - 4);
+            auto const p = static_cast<
+                unsigned char const*>(b.data().data());
+            b.consume(cap - 4);
+            append(b, pat);
+            BOOST_TEST_EQ(std::memcmp(
+                p, pat.data() + 4, pat.size() - 4), 0);
+            BOOST_TEST_EQ(std::memcmp(
+                p + cap - 4, pat.data(), 4), 0);
+        }
+
+        // a full buffer is one contiguous window
+        {
+            b.consume(b.size());
+            b.prepare(cap / 2);
+            b.commit(cap / 2);
+            b.consume(cap / 2);
+            auto const mb = b.prepare(cap);
+            std::memset(mb.data(), 'x', mb.size());
+            b.commit(cap);
+            BOOST_TEST_EQ(b.size(), cap);
+            BOOST_TEST_EQ(b.capacity(), 0);
+            b.consume(cap);
+            BOOST_TEST_EQ(b.size(), 0);
+        }
+#endif
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testWrap();
+    }
+};
+
+TEST_SUITE(
+    mirrored_buffer_test,
+    "boost.buffers.mirrored_buffer");
+
+} // buffers
+} // boost
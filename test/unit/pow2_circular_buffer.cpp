@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/pow2_circular_buffer.hpp>
+
+#include <boost/buffers/dynamic_buffer.hpp>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+BOOST_STATIC_ASSERT(is_dynamic_buffer<pow2_circular_buffer>::value);
+
+struct pow2_circular_buffer_test
+{
+    // smallest power of two which holds the pattern
+    static constexpr std::size_t cap = 16;
+
+    void
+    testMembers()
+    {
+        auto const& pat = test_pattern();
+        std::string s(cap, 0);
+
+        // pow2_circular_buffer()
+        {
+            pow2_circular_buffer cb;
+            BOOST_TEST_EQ(cb.size(), 0);
+            BOOST_TEST_EQ(cb.capacity(), 0);
+            BOOST_TEST_EQ(size(cb.prepare(0)), 0);
+        }
+
+        // pow2_circular_buffer(void*, std::size_t)
+        {
+            pow2_circular_buffer cb(&s[0], cap);
+            BOOST_TEST_EQ(cb.size(), 0);
+            BOOST_TEST_EQ(cb.capacity(), cap);
+            BOOST_TEST_EQ(cb.max_size(), cap);
+        }
+        {
+            pow2_circular_buffer cb(&s[0], 0);
+            BOOST_TEST_EQ(cb.max_size(), 0);
+            BOOST_TEST_THROWS(
+                pow2_circular_buffer(&s[0], 12),
+                std::invalid_argument);
+        }
+
+        // pow2_circular_buffer(
+        //  void*, std::size_t, std:size_t)
+        {
+            s = pat + '\0';
+            pow2_circular_buffer cb(&s[0], cap, 6);
+            BOOST_TEST_EQ(cb.size(), 6);
+            BOOST_TEST_EQ(cb.capacity(), cap - 6);
+            BOOST_TEST_EQ(
+                test::make_string(cb.data()),
+                pat.substr(0, 6));
+            BOOST_TEST_THROWS(
+                pow2_circular_buffer(&s[0], cap, cap + 1),
+                std::invalid_argument);
+        }
+
+        // pow2_circular_buffer(
+        //  pow2_circular_buffer const&)
+        // operator=(
+        //  pow2_circular_buffer const&)
+        {
+            pow2_circular_buffer cb0(&s[0], cap, 3);
+            pow2_circular_buffer cb1(cb0);
+            BOOST_TEST_EQ(cb1.size(), cb0.size());
+            BOOST_TEST_EQ(cb1.capacity(), cb0.capacity());
+            pow2_circular_buffer cb2;
+            cb2 = cb0;
+            BOOST_TEST_EQ(cb2.size(), cb0.size());
+            BOOST_TEST_EQ(cb2.max_size(), cb0.max_size());
+        }
+
+        // prepare(std::size_t)
+        {
+            pow2_circular_buffer cb(&s[0], cap);
+            BOOST_TEST_THROWS(
+                cb.prepare(cb.capacity() + 1),
+                std::length_error);
+        }
+
+        // wrap around
+        {
+            pow2_circular_buffer cb(&s[0], cap);
+            cb.prepare(cap - 3);
+            cb.commit(cap - 3);
+            cb.consume(cap - 5);
+            auto const mb = cb.prepare(cb.capacity());
+            BOOST_TEST_EQ(size(mb), cap - 2);
+            BOOST_TEST_EQ(mb[0].size(), 3);
+            BOOST_TEST_EQ(mb[1].size(), cap - 5);
+            cb.commit(copy(mb,
+                make_buffer(pat.data(), pat.size())));
+            auto const cbs = cb.data();
+            BOOST_TEST_EQ(cbs[0].size(), 5);
+            BOOST_TEST_EQ(cbs[1].size(), cap - 5);
+            BOOST_TEST_EQ(
+                test::make_string(cbs).substr(2),
+                pat.substr(0, cap - 2));
+        }
+    }
+
+    void
+    testBuffer()
+    {
+        auto const& pat = test_pattern();
+
+        for(std::size_t i = 0;
+            i <= pat.size(); ++i)
+        for(std::size_t j = 0;
+            j <=  pat.size(); ++j)
+        for(std::size_t k = 0;
+            k <= pat.size(); ++k)
+        {
+            std::string s(cap, 0);
+            pow2_circular_buffer bs(
+                &s[0], s.size());
+            if( j < pat.size() &&
+                i > 0)
+            {
+                bs.prepare(i);
+                bs.commit(i);
+                BOOST_TEST_EQ(
+                    bs.capacity(),
+                    bs.max_size() - bs.size());
+                bs.consume(i - 1);
+                bs.commit(copy(
+                    bs.prepare(j),
+                    make_buffer(
+                        pat.data(),
+                        pat.size())));
+                bs.consume(1);
+            }
+            else
+            {
+                bs.commit(copy(
+                    bs.prepare(j),
+                    make_buffer(
+                        pat.data(),
+                        pat.size())));
+            }
+            bs.commit(copy(
+                bs.prepare(pat.size() - j),
+                make_buffer(
+                    pat.data() + j,
+                    pat.size() - j)));
+            BOOST_TEST_EQ(test::make_string(
+                bs.data()), pat);
+            test::check_sequence(bs.data(), pat);
+            bs.consume(k);
+            BOOST_TEST_EQ(test::make_string(
+                bs.data()), pat.substr(k));
+        }
+    }
+
+    void
+    testInterleavedReadWrite()
+    {
+        auto const& pat = test_pattern();
+
+        for(std::size_t i = 0; i <= pat.size(); ++i)
+        {
+            std::string s = pat + '\0';
+            pow2_circular_buffer cb(&s[0], cap);
+            cb.prepare(i);
+            cb.commit(i);
+            BOOST_TEST_EQ(
+                test::make_string(cb.data()),
+                pat.substr(0, i));
+            // commit after consume
+            auto n = pat.size() - i;
+            cb.prepare(n);
+            cb.consume(i);
+            BOOST_TEST_EQ(cb.size(), 0);
+            cb.commit(n);
+            BOOST_TEST_EQ(
+                test::make_string(cb.data()),
+                pat.substr(i, n));
+        }
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testBuffer();
+        testInterleavedReadWrite();
+    }
+};
+
+constexpr std::size_t pow2_circular_buffer_test::cap;
+
+TEST_SUITE(
+    pow2_circular_buffer_test,
+    "boost.buffers.pow2_circular_buffer");
+
+} // buffers
+} // boost
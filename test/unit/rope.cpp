@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/rope.hpp>
+
+#include <boost/buffers/make_buffer.hpp>
+#include <boost/buffers/slice.hpp>
+#include <boost/static_assert.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+BOOST_STATIC_ASSERT(is_const_buffer_sequence<rope>::value);
+BOOST_STATIC_ASSERT(! is_mutable_buffer_sequence<rope>::value);
+BOOST_STATIC_ASSERT(std::is_same<
+    slice_type<rope>, rope_slice>::value);
+BOOST_STATIC_ASSERT(std::is_same<
+    slice_type<rope_slice>, rope_slice>::value);
+BOOST_STATIC_ASSERT(std::is_nothrow_copy_constructible<
+    rope_slice>::value);
+BOOST_STATIC_ASSERT(std::is_nothrow_move_constructible<
+    rope>::value);
+
+struct rope_test
+{
+    // A rope over s with segments of length n
+    static
+    rope
+    make_rope(
+        core::string_view s,
+        std::size_t n)
+    {
+        rope r;
+        for(std::size_t i = 0; i < s.size(); i += n)
+            r.append(make_buffer(s.data() + i,
+                (std::min)(n, s.size() - i)));
+        return r;
+    }
+
+    static
+    std::size_t
+    count(rope const& r)
+    {
+        return static_cast<std::size_t>(
+            std::distance(r.begin(), r.end()));
+    }
+
+    void
+    testMembers()
+    {
+        auto const& pat = test_pattern();
+
+        // rope()
+        {
+            rope r;
+            BOOST_TEST(r.empty());
+            BOOST_TEST_EQ(size(r), 0);
+            BOOST_TEST(r.begin() == r.end());
+        }
+
+        // rope(ConstBufferSequence)
+        {
+            std::vector<const_buffer> v = {
+                make_buffer(pat.data(), 3),
+                const_buffer(),
+                make_buffer(pat.data() + 3, pat.size() - 3) };
+            rope r(v);
+            BOOST_TEST_EQ(count(r), 2);
+            BOOST_TEST_EQ(test::make_string(r), pat);
+        }
+
+        // append(const_buffer)
+        {
+            rope r;
+            r.append(const_buffer());
+            BOOST_TEST(r.empty());
+            r.append(make_buffer(pat.data(), 5));
+            BOOST_TEST_EQ(size(r), 5);
+            BOOST_TEST_EQ((*r.begin()).data(), pat.data());
+        }
+
+        // copy and move
+        {
+            rope r0 = make_rope(pat, 2);
+            rope r1(r0);
+            BOOST_TEST_EQ(test::make_string(r1), pat);
+            BOOST_TEST_EQ((*r1.begin()).data(), pat.data());
+            r1.split(3);
+            BOOST_TEST_EQ(test::make_string(r0), pat);
+            rope r2(std::move(r0));
+            BOOST_TEST(r0.empty());
+            BOOST_TEST_EQ(test::make_string(r2), pat);
+            r0 = r2;
+            BOOST_TEST_EQ(test::make_string(r0), pat);
+            r2 = std::move(r1);
+            BOOST_TEST_EQ(test::make_string(r2), pat.substr(0, 3));
+            r2.clear();
+            BOOST_TEST(r2.empty());
+        }
+    }
+
+    void
+    testSequence()
+    {
+        auto const& pat = test_pattern();
+        for(std::size_t n = 1; n <= pat.size(); ++n)
+            test::check_sequence(make_rope(pat, n), pat);
+    }
+
+    void
+    testSlice()
+    {
+        auto const& pat = test_pattern();
+
+        // rope_slice()
+        {
+            rope_slice s;
+            BOOST_TEST_EQ(size(s), 0);
+            BOOST_TEST(s.begin() == s.end());
+        }
+
+        // every window of every segment size
+        for(std::size_t n = 1; n <= pat.size(); ++n)
+        {
+            rope const r = make_rope(pat, n);
+            for(std::size_t i = 0; i <= pat.size(); ++i)
+            for(std::size_t j = i; j <= pat.size(); ++j)
+            {
+                auto const s = prefix(
+                    sans_prefix(r, i), j - i);
+                auto const v = pat.substr(i, j - i);
+                BOOST_TEST_EQ(size(s), v.size());
+                BOOST_TEST_EQ(test::make_string(s), v);
+                test::check_iterators(s, v);
+
+                // no empty segments
+                for(auto b : s)
+                    BOOST_TEST_GT(b.size(), 0);
+            }
+            test::check_sequence(rope_slice(r), pat);
+        }
+
+        // slices refer to the segments of the rope
+        {
+            rope const r = make_rope(pat, 3);
+            auto const s = suffix(r, pat.size() - 4);
+            BOOST_TEST_EQ((*s.begin()).data(), pat.data() + 4);
+            BOOST_TEST_EQ((*s.begin()).size(), 2);
+            BOOST_TEST_EQ(size(sans_suffix(r, 4)), pat.size() - 4);
+        }
+    }
+
+    void
+    testSplit()
+    {
+        auto const& pat = test_pattern();
+
+        // every offset and segment size
+        for(std::size_t n = 1; n <= pat.size(); ++n)
+        for(std::size_t i = 0; i <= pat.size() + 1; ++i)
+        {
+            rope r = make_rope(pat, n);
+            rope rest = r.split(i);
+            auto const j = (std::min)(i, pat.size());
+            BOOST_TEST_EQ(test::make_string(r), pat.substr(0, j));
+            BOOST_TEST_EQ(test::make_string(rest), pat.substr(j));
+            test::check_iterators(rest, pat.substr(j));
+
+            // and back together
+            r.append(std::move(rest));
+            BOOST_TEST(rest.empty());
+            BOOST_TEST_EQ(test::make_string(r), pat);
+            BOOST_TEST_LE(count(r), pat.size() / n + 2);
+        }
+    }
+
+    void
+    testRandom()
+    {
+        // cut and splice against a string model
+        std::string data;
+        for(std::size_t i = 0; i < 10000; ++i)
+            data.push_back(static_cast<char>('a' + i % 26));
+
+        std::mt19937 g(42);
+        rope r = make_rope(data, 7);
+        std::string model = data;
+        for(int i = 0; i < 2000; ++i)
+        {
+            auto const n = g() % (model.size() + 1);
+            rope mid = r.split(n);
+            rope tail = mid.split(g() % (model.size() - n + 1));
+            auto const m = size(mid);
+            std::string const a = model.substr(0, n);
+            std::string const b = model.substr(n, m);
+            std::string const c = model.substr(n + m);
+
+            // move the middle part to the front
+            mid.append(std::move(r));
+            mid.append(std::move(tail));
+            r = std::move(mid);
+            model = b + a + c;
+            BOOST_TEST_EQ(size(r), model.size());
+        }
+        std::string out(size(r), ' ');
+        std::size_t pos = 0;
+        for(auto b : r)
+        {
+            out.replace(pos, b.size(),
+                static_cast<char const*>(b.data()), b.size());
+            pos += b.size();
+        }
+        BOOST_TEST(out == model);
+
+        // prefix and suffix
+        BOOST_TEST(test::make_string(prefix(r, 100)) ==
+            model.substr(0, 100));
+        BOOST_TEST(test::make_string(suffix(r, 100)) ==
+            model.substr(model.size() - 100));
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testSequence();
+        testSlice();
+        testSplit();
+        testRandom();
+    }
+};
+
+TEST_SUITE(
+    rope_test,
+    "boost.buffers.rope");
+
+} // buffers
+} // boost
@@ -0,0 +1,370 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/segmented_buffer.hpp>
+
+#include <boost/buffers/copy.hpp>
+#include <boost/buffers/dynamic_buffer.hpp>
+#include <boost/buffers/make_buffer.hpp>
+#include <boost/static_assert.hpp>
+
+#include <iterator>
+#include <stdexcept>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+BOOST_STATIC_ASSERT(is_dynamic_buffer<segmented_buffer>::value);
+BOOST_STATIC_ASSERT(std::is_same<
+    std::iterator_traits<segmented_buffer::
+        const_buffers_type::const_iterator>::iterator_category,
+    std::bidirectional_iterator_tag>::value);
+BOOST_STATIC_ASSERT(std::is_nothrow_move_constructible<
+    segmented_buffer>::value);
+
+namespace {
+
+// An allocator which counts the bytes it has
+// outstanding and the calls to allocate
+template<class T, class Propagate = std::false_type>
+struct counting_allocator
+{
+    using value_type = T;
+    using propagate_on_container_copy_assignment = Propagate;
+
+    std::size_t* used;
+    std::size_t* calls;
+
+    counting_allocator(
+        std::size_t* used_,
+        std::size_t* calls_) noexcept
+        : used(used_)
+        , calls(calls_)
+    {
+    }
+
+    template<class U>
+    counting_allocator(
+        counting_allocator<U, Propagate> const& other) noexcept
+        : used(other.used)
+        , calls(other.calls)
+    {
+    }
+
+    T*
+    allocate(std::size_t n)
+    {
+        *used += n * sizeof(T);
+        ++*calls;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void
+    deallocate(T* p, std::size_t n) noexcept
+    {
+        *used -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<class U>
+    bool
+    operator==(
+        counting_allocator<U, Propagate> const& other) const noexcept
+    {
+        return used == other.used;
+    }
+
+    template<class U>
+    bool
+    operator!=(
+        counting_allocator<U, Propagate> const& other) const noexcept
+    {
+        return used != other.used;
+    }
+};
+
+} // (anon)
+
+struct segmented_buffer_test
+{
+    template<class Buffer>
+    static
+    void
+    append(
+        Buffer& b,
+        core::string_view s)
+    {
+        b.commit(copy(
+            b.prepare(s.size()),
+            make_buffer(s.data(), s.size())));
+    }
+
+    void
+    testMembers()
+    {
+        auto const& pat = test_pattern();
+
+        // segmented_buffer()
+        {
+            segmented_buffer b;
+            BOOST_TEST_EQ(b.size(), 0);
+            BOOST_TEST_EQ(b.capacity(), 0);
+            BOOST_TEST_EQ(b.block_size(),
+                segmented_buffer::default_block_size);
+            BOOST_TEST_EQ(size(b.data()), 0);
+            BOOST_TEST_EQ(size(b.prepare(0)), 0);
+            BOOST_TEST(b.data().begin() == b.data().end());
+        }
+
+        // segmented_buffer(std::size_t)
+        {
+            segmented_buffer b(4);
+            BOOST_TEST_EQ(b.block_size(), 4);
+            BOOST_TEST_THROWS(
+                segmented_buffer(0),
+                std::invalid_argument);
+        }
+
+        // segmented_buffer(std::size_t, std::size_t)
+        {
+            segmented_buffer b(4, 10);
+            BOOST_TEST_EQ(b.max_size(), 10);
+            BOOST_TEST_NO_THROW(b.prepare(10));
+            b.commit(6);
+            BOOST_TEST_THROWS(
+                b.prepare(5),
+                std::length_error);
+        }
+
+        // copy and move
+        {
+            segmented_buffer b0(4);
+            append(b0, pat);
+            b0.consume(5);
+            segmented_buffer b1(b0);
+            BOOST_TEST_EQ(b1.block_size(), 4);
+            BOOST_TEST_EQ(test::make_string(b1.data()), pat.substr(5));
+            segmented_buffer b2(3);
+            append(b2, "xyz");
+            b2 = b0;
+            BOOST_TEST_EQ(b2.block_size(), 3);
+            BOOST_TEST_EQ(test::make_string(b2.data()), pat.substr(5));
+            segmented_buffer b3(std::move(b1));
+            BOOST_TEST_EQ(test::make_string(b3.data()), pat.substr(5));
+            BOOST_TEST_EQ(b1.size(), 0);
+            BOOST_TEST_EQ(b1.capacity(), 0);
+            b2 = std::move(b3);
+            BOOST_TEST_EQ(b2.block_size(), 4);
+            BOOST_TEST_EQ(test::make_string(b2.data()), pat.substr(5));
+            BOOST_TEST_EQ(b3.size(), 0);
+        }
+    }
+
+    void
+    testSequences()
+    {
+        auto const& pat = test_pattern();
+
+        for(std::size_t bs = 1; bs <= pat.size() + 1; ++bs)
+        for(std::size_t i = 0; i <= pat.size(); ++i)
+        {
+            segmented_buffer b(bs);
+
+            // write the pattern after i bytes
+            // which are consumed in two steps
+            append(b, std::string(i, 'x'));
+            b.consume(i / 2);
+            append(b, pat);
+            b.consume(i - i / 2);
+            BOOST_TEST_EQ(test::make_string(b.data()), pat);
+            test::check_sequence(b.data(), pat);
+
+            // the writable bytes
+            auto const mb = b.prepare(pat.size());
+            BOOST_TEST_EQ(size(mb), pat.size());
+            copy(mb, make_buffer(pat.data(), pat.size()));
+            test::check_sequence(mb, pat);
+            b.commit(i);
+            BOOST_TEST_EQ(test::make_string(b.data()),
+                pat + pat.substr(0, i));
+            b.consume(pat.size());
+            BOOST_TEST_EQ(test::make_string(b.data()),
+                pat.substr(0, i));
+
+            // every segment fits in one block
+            for(auto it = b.data().end();
+                it != b.data().begin();)
+            {
+                const_buffer cb = *--it;
+                BOOST_TEST_LE(cb.size(), bs);
+                BOOST_TEST_GT(cb.size(), 0);
+            }
+        }
+    }
+
+    void
+    testGrowth()
+    {
+        auto const& pat = test_pattern();
+
+        // existing bytes are never moved
+        {
+            segmented_buffer b(8);
+            append(b, pat);
+            auto const p = (*b.data().begin()).data();
+            for(int i = 0; i < 100; ++i)
+                append(b, pat);
+            BOOST_TEST_EQ((*b.data().begin()).data(), p);
+            BOOST_TEST_EQ(b.size(), 101 * pat.size());
+        }
+
+        // data() remains valid after prepare and commit
+        {
+            segmented_buffer b(4);
+            append(b, pat.substr(0, 6));
+            auto const d = b.data();
+            append(b, pat.substr(6));
+            BOOST_TEST_EQ(test::make_string(d), pat.substr(0, 6));
+        }
+
+        // prepare() remains valid after consume
+        {
+            segmented_buffer b(4);
+            append(b, pat.substr(0, 6));
+            auto const mb = b.prepare(pat.size() - 6);
+            b.consume(6);
+            b.commit(copy(mb, make_buffer(
+                pat.data() + 6, pat.size() - 6)));
+            BOOST_TEST_EQ(test::make_string(b.data()), pat.substr(6));
+        }
+    }
+
+    void
+    testRecycle()
+    {
+        using alloc = counting_allocator<unsigned char>;
+        auto const& pat = test_pattern();
+        std::size_t used = 0;
+        std::size_t calls = 0;
+        {
+            basic_segmented_buffer<alloc> b(
+                4, alloc(&used, &calls));
+
+            // streaming reuses the consumed blocks
+            for(int i = 0; i < 3; ++i)
+            {
+                append(b, pat);
+                b.consume(pat.size());
+            }
+            auto const calls0 = calls;
+            for(int i = 0; i < 100; ++i)
+            {
+                append(b, pat);
+                b.consume(pat.size());
+            }
+            BOOST_TEST_EQ(calls, calls0);
+            BOOST_TEST_GE(b.capacity(), pat.size());
+
+            // shrink_to_fit releases unused blocks
+            b.shrink_to_fit();
+            BOOST_TEST_EQ(b.capacity(), 0);
+            BOOST_TEST_EQ(used, 0);
+
+            // and keeps the readable bytes
+            append(b, pat);
+            b.consume(5);
+            b.prepare(100);
+            b.shrink_to_fit();
+            BOOST_TEST_EQ(test::make_string(b.data()), pat.substr(5));
+            BOOST_TEST_LT(b.capacity(), 4);
+            append(b, pat.substr(0, 5));
+            BOOST_TEST_EQ(test::make_string(b.data()),
+                pat.substr(5) + pat.substr(0, 5));
+
+            // clear keeps the blocks
+            auto const used0 = used;
+            b.clear();
+            BOOST_TEST_EQ(b.size(), 0);
+            BOOST_TEST_EQ(used, used0);
+        }
+        BOOST_TEST_EQ(used, 0);
+    }
+
+    void
+    testAllocator()
+    {
+        auto const& pat = test_pattern();
+        std::size_t used0 = 0;
+        std::size_t used1 = 0;
+        std::size_t calls = 0;
+
+        // copy assignment keeps the allocator
+        {
+            using alloc = counting_allocator<unsigned char>;
+            basic_segmented_buffer<alloc> b0(4, alloc(&used0, &calls));
+            basic_segmented_buffer<alloc> b1(4, alloc(&used1, &calls));
+            append(b0, pat);
+            append(b1, pat.substr(0, 10));
+            b1.consume(10);
+            b1 = b0;
+            BOOST_TEST_EQ(test::make_string(b1.data()), pat);
+            BOOST_TEST(b1.get_allocator() == alloc(&used1, &calls));
+            BOOST_TEST_EQ(used0, used1);
+        }
+        BOOST_TEST_EQ(used0, 0);
+        BOOST_TEST_EQ(used1, 0);
+
+        // copy assignment propagates the allocator,
+        // and returns the blocks to the old one
+        {
+            using palloc = counting_allocator<
+                unsigned char, std::true_type>;
+            basic_segmented_buffer<palloc> b0(4, palloc(&used0, &calls));
+            basic_segmented_buffer<palloc> b1(4, palloc(&used1, &calls));
+            append(b0, pat);
+            append(b1, pat.substr(0, 10));
+            b1.consume(6);
+            BOOST_TEST_GT(used1, 0);
+            auto const used = used0;
+            b1 = b0;
+            BOOST_TEST_EQ(test::make_string(b1.data()), pat);
+            BOOST_TEST(b1.get_allocator() == palloc(&used0, &calls));
+            BOOST_TEST_EQ(used1, 0);
+            BOOST_TEST_EQ(used0, 2 * used);
+
+            // equal allocators keep the blocks
+            b1.clear();
+            b1 = b0;
+            BOOST_TEST_EQ(used0, 2 * used);
+            BOOST_TEST_EQ(test::make_string(b1.data()), pat);
+        }
+        BOOST_TEST_EQ(used0, 0);
+        BOOST_TEST_EQ(used1, 0);
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testSequences();
+        testGrowth();
+        testRecycle();
+        testAllocator();
+    }
+};
+
+TEST_SUITE(
+    segmented_buffer_test,
+    "boost.buffers.segmented_buffer");
+
+} // buffers
+} // boost
@@ -0,0 +1,237 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/shared_buffer.hpp>
+
+#include <boost/buffers/copy.hpp>
+#include <boost/buffers/flat_buffer.hpp>
+#include <boost/buffers/make_buffer.hpp>
+#include <boost/buffers/slice.hpp>
+#include <boost/static_assert.hpp>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+BOOST_STATIC_ASSERT(is_const_buffer_sequence<shared_buffer>::value);
+BOOST_STATIC_ASSERT(is_const_buffer_sequence<shared_buffers>::value);
+BOOST_STATIC_ASSERT(! is_mutable_buffer_sequence<shared_buffer>::value);
+BOOST_STATIC_ASSERT(! is_mutable_buffer_sequence<shared_buffers>::value);
+BOOST_STATIC_ASSERT(std::is_same<
+    slice_type<shared_buffers>, shared_buffers>::value);
+BOOST_STATIC_ASSERT(std::is_nothrow_move_constructible<
+    shared_buffer>::value);
+
+struct shared_buffer_test
+{
+    void
+    testBlock()
+    {
+        auto const& pat = test_pattern();
+
+        // shared_block()
+        {
+            shared_block b;
+            BOOST_TEST_EQ(b.data(), nullptr);
+            BOOST_TEST_EQ(b.size(), 0);
+            BOOST_TEST_EQ(b.use_count(), 0);
+        }
+
+        // shared_block(ConstBufferSequence)
+        {
+            std::string s = pat;
+            shared_block b(make_buffer(s.data(), s.size()));
+            s.assign(s.size(), 'x');
+            BOOST_TEST_EQ(b.size(), pat.size());
+            BOOST_TEST_EQ(test::make_string(const_buffer(
+                b.data(), b.size())), pat);
+            BOOST_TEST_EQ(b.use_count(), 1);
+        }
+
+        // copies share the bytes
+        {
+            shared_block b0(make_buffer(pat.data(), pat.size()));
+            shared_block b1(b0);
+            BOOST_TEST_EQ(b1.data(), b0.data());
+            BOOST_TEST_EQ(b0.use_count(), 2);
+            shared_block b2;
+            b2 = b1;
+            BOOST_TEST_EQ(b0.use_count(), 3);
+            shared_block b3(std::move(b2));
+            BOOST_TEST_EQ(b2.use_count(), 0);
+            BOOST_TEST_EQ(b3.use_count(), 3);
+            b3 = shared_block();
+            BOOST_TEST_EQ(b0.use_count(), 2);
+            b1 = std::move(b0);
+            BOOST_TEST_EQ(b1.use_count(), 1);
+            swap(b0, b1);
+            BOOST_TEST_EQ(b0.use_count(), 1);
+            BOOST_TEST_EQ(b1.use_count(), 0);
+        }
+
+        // copies are destroyed concurrently
+        {
+            shared_block b(make_buffer(pat.data(), pat.size()));
+            std::vector<std::thread> threads;
+            for(int t = 0; t < 4; ++t)
+            {
+                threads.emplace_back([b]
+                {
+                    std::vector<shared_block> v(1000, b);
+                });
+            }
+            for(auto& t : threads)
+                t.join();
+            BOOST_TEST_EQ(b.use_count(), 1);
+        }
+    }
+
+    void
+    testBuffer()
+    {
+        auto const& pat = test_pattern();
+        shared_block const blk(make_buffer(pat.data(), pat.size()));
+
+        // shared_buffer()
+        {
+            shared_buffer b;
+            BOOST_TEST_EQ(b.size(), 0);
+            BOOST_TEST_EQ(size(b), 0);
+        }
+
+        // shared_buffer(shared_block)
+        {
+            shared_buffer b(blk);
+            BOOST_TEST_EQ(b.data(), blk.data());
+            BOOST_TEST_EQ(b.block().use_count(), 2);
+            test::check_sequence(b, pat);
+        }
+
+        // shared_buffer(shared_block, std::size_t, std::size_t)
+        {
+            shared_buffer b(blk, 3, 5);
+            BOOST_TEST_EQ(test::make_string(b), pat.substr(3, 5));
+            test::check_sequence(b, pat.substr(3, 5));
+            BOOST_TEST_EQ(size(shared_buffer(blk, 3, 1000)),
+                pat.size() - 3);
+            BOOST_TEST_EQ(size(shared_buffer(blk, 1000, 1)), 0);
+        }
+
+        // shared_buffer(ConstBufferSequence)
+        {
+            unsigned char tmp[32];
+            flat_buffer fb(tmp, sizeof(tmp));
+            fb.commit(copy(fb.prepare(pat.size()),
+                make_buffer(pat.data(), pat.size())));
+            shared_buffer b(fb.data());
+            std::memset(tmp, 'x', sizeof(tmp));
+            BOOST_TEST_EQ(test::make_string(b), pat);
+        }
+
+        // slices keep the block alive
+        {
+            shared_buffer b0(make_buffer(pat.data(), pat.size()));
+            auto b1 = prefix(b0, 4);
+            auto b2 = suffix(b0, 4);
+            b0 = shared_buffer();
+            BOOST_TEST_EQ(b1.block().use_count(), 2);
+            BOOST_TEST_EQ(test::make_string(b1), pat.substr(0, 4));
+            BOOST_TEST_EQ(test::make_string(b2),
+                pat.substr(pat.size() - 4));
+        }
+    }
+
+    void
+    testBuffers()
+    {
+        auto const& pat = test_pattern();
+        shared_block const blk(make_buffer(pat.data(), pat.size()));
+
+        // shared_buffers()
+        {
+            shared_buffers bs;
+            BOOST_TEST(bs.empty());
+            BOOST_TEST_EQ(size(bs), 0);
+            BOOST_TEST(bs.begin() == bs.end());
+        }
+
+        // every split of the pattern
+        for(std::size_t i = 0; i <= pat.size(); ++i)
+        for(std::size_t j = i; j <= pat.size(); ++j)
+        {
+            shared_buffers bs{
+                shared_buffer(blk, 0, i),
+                shared_buffer(blk, i, j - i),
+                shared_buffer(blk, j, pat.size() - j) };
+            BOOST_TEST(! bs.empty());
+            test::check_sequence(bs, pat);
+        }
+
+        // copying shares the blocks
+        {
+            shared_buffers bs0;
+            bs0.push_back(shared_buffer(blk, 0, 5));
+            bs0.push_back(shared_buffer(blk, 5, 100));
+            std::vector<shared_buffers> queues(100, bs0);
+            BOOST_TEST_EQ(blk.use_count(), 1 + 2 + 100 * 2);
+            for(auto const& q : queues)
+            {
+                BOOST_TEST_EQ(
+                    (*q.begin()).data(), blk.data());
+                BOOST_TEST_EQ(test::make_string(q), pat);
+            }
+        }
+
+        // slicing releases whole buffers
+        {
+            shared_block b0(make_buffer(pat.data(), 5));
+            shared_block b1(make_buffer(pat.data() + 5, 5));
+            shared_buffers bs{
+                shared_buffer(b0), shared_buffer(b1) };
+            remove_prefix(bs, 5);
+            BOOST_TEST_EQ(b0.use_count(), 1);
+            BOOST_TEST_EQ(b1.use_count(), 2);
+            BOOST_TEST_EQ(test::make_string(bs), pat.substr(5, 5));
+            bs.clear();
+            BOOST_TEST_EQ(b1.use_count(), 1);
+        }
+
+        // copy into a mutable buffer
+        {
+            shared_buffers bs{
+                shared_buffer(blk, 0, 7),
+                shared_buffer(blk, 7, 100) };
+            std::string s(pat.size(), ' ');
+            BOOST_TEST_EQ(copy(
+                make_buffer(&s[0], s.size()), bs), pat.size());
+            BOOST_TEST_EQ(s, pat);
+        }
+    }
+
+    void
+    run()
+    {
+        testBlock();
+        testBuffer();
+        testBuffers();
+    }
+};
+
+TEST_SUITE(
+    shared_buffer_test,
+    "boost.buffers.shared_buffer");
+
+} // buffers
+} // boost
@@ -14,9 +14,12 @@
 #include <boost/buffers/copy.hpp>
 #include <boost/buffers/make_buffer.hpp>
 #include <boost/core/detail/string_view.hpp>
+#include <boost/core/span.hpp>
 #include <boost/static_assert.hpp>
 
 #include <array>
+#include <list>
+#include <memory>
 #include <vector>
 
 #include "test_buffers.hpp"
@@ -75,6 +78,38 @@ make_buffers(
     return v;
 }
 
+// A sequence which only customizes the prefix forms
+struct prefix_only_buffers
+{
+    const_buffer_pair bs;
+
+    const_buffer const*
+    begin() const noexcept
+    {
+        return bs.data();
+    }
+
+    const_buffer const*
+    end() const noexcept
+    {
+        return bs.data() + bs.size();
+    }
+
+    friend
+    void
+    tag_invoke(
+        slice_tag const&,
+        prefix_only_buffers& b,
+        slice_how how,
+        std::size_t n)
+    {
+        BOOST_TEST(
+            how == slice_how::remove_prefix ||
+            how == slice_how::keep_prefix);
+        tag_invoke(slice_tag{}, b.bs, how, n);
+    }
+};
+
 struct slice_test
 {
     static
@@ -174,9 +209,178 @@ struct slice_test
         }
     }
 
+    // Copies and moves must refer to their own
+    // sequence, not the one they were made from.
+    void
+    testCopy()
+    {
+        std::string s;
+        auto a = make_buffers(s, "boost.", "buffers.", "slice_");
+        std::list<const_buffer> l(a.begin(), a.end());
+        core::string_view const pat =
+            core::string_view(s).substr(3, s.size() - 5);
+
+        {
+            auto bs0 = std::unique_ptr<slice_of<std::list<const_buffer>>>(
+                new slice_of<std::list<const_buffer>>(l));
+            remove_prefix(*bs0, 3);
+            remove_suffix(*bs0, 2);
+            slice_of<std::list<const_buffer>> bs1(*bs0);
+            slice_of<std::list<const_buffer>> bs2;
+            bs2 = *bs0;
+            bs0.reset();
+            check(bs1, pat);
+            check(bs2, pat);
+
+            slice_of<std::list<const_buffer>> bs3(std::move(bs1));
+            slice_of<std::list<const_buffer>> bs4;
+            bs4 = std::move(bs2);
+            check(bs3, pat);
+            check(bs4, pat);
+
+            auto const& self = bs3;
+            bs3 = self;
+            check(bs3, pat);
+        }
+
+        {
+            slice_of<seq_type> bs(seq_type(a.begin(), a.end()));
+            keep_prefix(bs, 0);
+            check(bs, "");
+            slice_of<seq_type> bs1(bs);
+            check(bs1, "");
+        }
+    }
+
+    // Trimming must account for empty buffers and
+    // for bytes already removed from either end.
+    void
+    testEmptySegments()
+    {
+        core::string_view const pat = "abcdefgh";
+        std::list<const_buffer> l;
+        l.emplace_back(nullptr, 0);
+        l.emplace_back(pat.data(), 3);
+        l.emplace_back(nullptr, 0);
+        l.emplace_back(pat.data() + 3, 5);
+        l.emplace_back(nullptr, 0);
+        test::check_sequence(l, pat);
+
+        slice_of<std::list<const_buffer>> bs(l);
+        BOOST_TEST_EQ(size(bs), 8);
+        keep_prefix(bs, 6);
+        check(bs, "abcdef");
+        remove_prefix(bs, 3);
+        check(bs, "def");
+        keep_prefix(bs, 2);
+        check(bs, "de");
+        remove_prefix(bs, 1);
+        check(bs, "e");
+        keep_prefix(bs, 5);
+        check(bs, "e");
+        remove_prefix(bs, 5);
+        check(bs, "");
+        BOOST_TEST(bs.begin() == bs.end());
+
+        check(prefix(l, 3), "abc");
+        check(sans_prefix(l, 3), "defgh");
+        check(suffix(l, 3), "fgh");
+        check(sans_suffix(l, 3), "abcde");
+    }
+
+    void
+    testSpan()
+    {
+        BOOST_STATIC_ASSERT(std::is_same<
+            slice_type<span<const_buffer const>>,
+            span_slice<const_buffer>>::value);
+        BOOST_STATIC_ASSERT(std::is_same<
+            slice_type<span<const_buffer const, 3>>,
+            span_slice<const_buffer>>::value);
+        BOOST_STATIC_ASSERT(std::is_same<
+            slice_type<span<mutable_buffer>>,
+            span_slice<mutable_buffer>>::value);
+        BOOST_STATIC_ASSERT(std::is_same<
+            slice_type<span_slice<const_buffer>>,
+            span_slice<const_buffer>>::value);
+        BOOST_STATIC_ASSERT(is_const_buffer_sequence<
+            span_slice<const_buffer>>::value);
+        BOOST_STATIC_ASSERT(! is_mutable_buffer_sequence<
+            span_slice<const_buffer>>::value);
+        BOOST_STATIC_ASSERT(is_mutable_buffer_sequence<
+            span_slice<mutable_buffer>>::value);
+        BOOST_STATIC_ASSERT(std::is_same<
+            std::iterator_traits<span_slice<const_buffer>::const_iterator
+                >::iterator_category,
+            std::random_access_iterator_tag>::value);
+
+        std::string s;
+        auto a = make_buffers(s, "boost.", "", "buffers.", "slice_");
+        test::check_sequence(span<const_buffer const>(a.data(), a.size()), s);
+        test::check_sequence(span<const_buffer const>(), "");
+
+        char buf[] = "0123456789";
+        std::array<mutable_buffer, 3> m{{
+            { buf, 3 }, { buf + 3, 3 }, { buf + 6, 4 } }};
+        test::check_sequence(span<mutable_buffer>(m.data(), m.size()),
+            core::string_view(buf, 10));
+
+        // trimmed ends in the middle of a span
+        auto bs = prefix(sans_prefix(span<mutable_buffer const>(
+            m.data(), m.size()), 2), 6);
+        check(bs, "234567");
+        auto it = bs.begin();
+        BOOST_TEST_EQ(bs.end() - it, 3);
+        BOOST_TEST_EQ(it[2].size(), 2);
+        BOOST_TEST_EQ(static_cast<char*>((*(it + 2)).data())[0], '6');
+    }
+
+    void
+    testSuffix()
+    {
+        BOOST_STATIC_ASSERT(has_suffix_slice<const_buffer>::value);
+        BOOST_STATIC_ASSERT(has_suffix_slice<mutable_buffer>::value);
+        BOOST_STATIC_ASSERT(has_suffix_slice<const_buffer_pair>::value);
+        BOOST_STATIC_ASSERT(has_suffix_slice<mutable_buffer_pair>::value);
+        BOOST_STATIC_ASSERT(has_suffix_slice<slice_of<seq_type>>::value);
+        BOOST_STATIC_ASSERT(has_suffix_slice<span_slice<const_buffer>>::value);
+        BOOST_STATIC_ASSERT(! has_suffix_slice<prefix_only_buffers>::value);
+
+        // fallback to the prefix forms
+        core::string_view const pat = "Hello, world!";
+        prefix_only_buffers bs{{{
+            { pat.data(), 5 },
+            { pat.data() + 5, pat.size() - 5 } }}};
+        test::check_sequence(bs, pat);
+
+        // suffix trims on both ends of a list
+        std::string s;
+        auto a = make_buffers(s, "boost.", "buffers.", "slice_");
+        std::list<const_buffer> l(a.begin(), a.end());
+        slice_of<std::list<const_buffer>> bl(l);
+        remove_suffix(bl, 2);
+        check(bl, "boost.buffers.slic");
+        keep_suffix(bl, 12);
+        check(bl, "buffers.slic");
+        remove_prefix(bl, 3);
+        remove_suffix(bl, 6);
+        check(bl, "fer");
+        keep_suffix(bl, 3);
+        check(bl, "fer");
+        slice_of<std::list<const_buffer>> bl2(bl);
+        check(bl2, "fer");
+        keep_suffix(bl, 0);
+        check(bl, "");
+    }
+
     void
     run()
     {
+        testCopy();
+        testSuffix();
+        testEmptySegments();
+        testSpan();
+
         std::string s;
         auto a = make_buffers(s, "boost.", "buffers.", "slice_");
         seq_type bs(a.begin(), a.end());
@@ -158,6 +158,61 @@ struct string_buffer_test
                 }
                 BOOST_TEST(s.empty());
             }
+            {
+                // the consumed prefix is removed lazily
+                s = "123456789";
+                {
+                    string_buffer b(&s);
+                    b.consume(2);
+                    BOOST_TEST_EQ(s, "123456789");
+                    BOOST_TEST_EQ(
+                        test::make_string(b.data()),
+                        "3456789");
+                    b.consume(3);
+                    BOOST_TEST_EQ(s.substr(0, 4), "6789");
+                    BOOST_TEST_EQ(
+                        test::make_string(b.data()),
+                        "6789");
+                    b.consume(1);
+                    auto n = copy(
+                        b.prepare(3),
+                        make_buffer("abc", 3));
+                    b.commit(n);
+                    BOOST_TEST_EQ(
+                        test::make_string(b.data()),
+                        "789abc");
+                }
+                BOOST_TEST_EQ(s, "789abc");
+            }
+            {
+                // finalized on destruction
+                s = "12345";
+                {
+                    string_buffer b(&s);
+                    b.consume(1);
+                    b.prepare(10);
+                    b.commit(0);
+                }
+                BOOST_TEST_EQ(s, "2345");
+            }
+        }
+
+        // string_buffer(string_buffer&&)
+        {
+            s = "12345";
+            {
+                string_buffer b0(&s);
+                b0.consume(1);
+                auto n = copy(
+                    b0.prepare(2),
+                    make_buffer("67", 2));
+                b0.commit(n);
+                string_buffer b1(std::move(b0));
+                BOOST_TEST_EQ(
+                    test::make_string(b1.data()),
+                    "234567");
+            }
+            BOOST_TEST_EQ(s, "234567");
         }
     }
 
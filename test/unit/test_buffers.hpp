@@ -20,6 +20,11 @@
 
 #include <string>
 
+#ifdef BOOST_HAS_UNISTD_H
+#include <cstdlib>
+#include <unistd.h>
+#endif
+
 // Trick boostdep into requiring URL
 // since we need it for the unit tests
 #ifdef BOOST_RUNTIME_SERVICES_BOOSTDEP
@@ -428,6 +433,33 @@ check_sequence(
     check_slice(t, pat);
 }
 
+#ifdef BOOST_HAS_UNISTD_H
+
+// A temporary file removed on scope exit
+struct temp_file
+{
+    std::string path;
+
+    explicit
+    temp_file(std::string const& s)
+    {
+        char name[] = "/tmp/boost_buffers_XXXXXX";
+        int const fd = ::mkstemp(name);
+        BOOST_TEST_NE(fd, -1);
+        path = name;
+        BOOST_TEST_EQ(::write(fd, s.data(), s.size()),
+            static_cast<ssize_t>(s.size()));
+        ::close(fd);
+    }
+
+    ~temp_file()
+    {
+        ::unlink(path.c_str());
+    }
+};
+
+#endif
+
 } // test
 
 inline
@@ -0,0 +1,355 @@
+//
+// Copyright (c) 2026 Vinnie Falco (vinnie.falco@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/buffers
+//
+
+// Test that header file is self-contained.
+#include <boost/buffers/uring_read_source.hpp>
+
+#ifdef BOOST_HAS_UNISTD_H
+
+#include <boost/buffers/any_read_source.hpp>
+#include <boost/buffers/buffer_pair.hpp>
+#include <boost/buffers/read_source.hpp>
+#include <boost/system/system_error.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "test_buffers.hpp"
+
+namespace boost {
+namespace buffers {
+
+BOOST_STATIC_ASSERT(is_read_source<uring_read_source>::value);
+BOOST_STATIC_ASSERT(has_size<uring_read_source>::value);
+BOOST_STATIC_ASSERT(has_rewind<uring_read_source>::value);
+BOOST_STATIC_ASSERT(is_read_source<uring_stream_source>::value);
+BOOST_STATIC_ASSERT(! has_size<uring_stream_source>::value);
+BOOST_STATIC_ASSERT(! has_rewind<uring_stream_source>::value);
+
+struct uring_read_source_test
+{
+    static
+    std::string
+    make_contents(std::size_t n)
+    {
+        std::string s;
+        for(std::size_t i = 0; i < n; ++i)
+            s.push_back(static_cast<char>('a' + i * 7 % 26));
+        return s;
+    }
+
+    // Read the source into k-byte pieces
+    // scattered across 5-byte buffers
+    template<class Source>
+    static
+    std::string
+    read_all(
+        Source& src,
+        std::size_t k)
+    {
+        std::string s;
+        std::vector<char> buf(k);
+        std::vector<mutable_buffer> v;
+        for(std::size_t i = 0; i < k; i += 5)
+            v.emplace_back(&buf[i],
+                (std::min)(std::size_t(5), k - i));
+        for(;;)
+        {
+            system::error_code ec;
+            auto const n = src.read(v, ec);
+            s.append(buf.data(), n);
+            if(ec == error::eof)
+                break;
+            if(! BOOST_TEST(! ec.failed()))
+                break;
+            BOOST_TEST_EQ(n, k);
+        }
+        return s;
+    }
+
+    // Read the source with requests of varying
+    // size, some of them split across two buffers
+    static
+    std::string
+    read_mixed(uring_read_source& src)
+    {
+        std::string s;
+        std::vector<char> buf(600000);
+        std::size_t i = 0;
+        for(;;)
+        {
+            static std::size_t const sizes[] = {
+                10, 9000, 1, 4096, 300000, 300, 8193, 600000 };
+            auto const k = sizes[i++ % 8];
+            system::error_code ec;
+            std::size_t n;
+            if(i % 2)
+                n = src.read(mutable_buffer(
+                    buf.data(), k), ec);
+            else
+                n = src.read(mutable_buffer_pair{{
+                    { buf.data(), k / 3 },
+                    { buf.data() + k / 3, k - k / 3 } }}, ec);
+            s.append(buf.data(), n);
+            if(ec == error::eof)
+                break;
+            if(! BOOST_TEST(! ec.failed()))
+                break;
+            BOOST_TEST_EQ(n, k);
+        }
+        return s;
+    }
+
+    static
+    std::vector<uring_read_source::options>
+    all_options()
+    {
+        std::vector<uring_read_source::options> v;
+        uring_read_source::options opt;
+        v.push_back(opt);
+        opt.queue_depth = 1;
+        opt.block_size = 4096;
+        v.push_back(opt);
+        opt.queue_depth = 8;
+        v.push_back(opt);
+        opt.use_uring = false;
+        v.push_back(opt);
+        return v;
+    }
+
+    void
+    testFile()
+    {
+        // several blocks, and a partial one
+        auto const s = make_contents(5 * 4096 + 123);
+        test::temp_file const f(s);
+
+        // several default blocks
+        auto const s2 = make_contents(7 * 256 * 1024 + 4567);
+        test::temp_file const f2(s2);
+
+        // uring_read_source()
+        {
+            uring_read_source src;
+            BOOST_TEST(! src.is_uring());
+            BOOST_TEST_EQ(src.size(), 0);
+            src.rewind();
+            char c;
+            system::error_code ec;
+            BOOST_TEST_EQ(src.read(
+                mutable_buffer(&c, 1), ec), 0);
+            BOOST_TEST(ec == error::eof);
+        }
+
+        for(auto const& opt : all_options())
+        {
+            for(std::size_t k : { 1, 100, 4096, 10000, 30000 })
+            {
+                uring_read_source src(f.path.c_str(), opt);
+                if(! opt.use_uring)
+                    BOOST_TEST(! src.is_uring());
+                BOOST_TEST_EQ(src.size(), s.size());
+                BOOST_TEST(read_all(src, k) == s);
+            }
+
+            // large reads skip the blocks
+            {
+                uring_read_source src(f2.path.c_str(), opt);
+                BOOST_TEST(read_mixed(src) == s2);
+                src.rewind();
+                BOOST_TEST(read_all(src, 1000) == s2);
+                src.rewind();
+                BOOST_TEST(read_mixed(src) == s2);
+            }
+
+            // rewind with reads in flight
+            {
+                uring_read_source src(f.path.c_str(), opt);
+                char buf[10];
+                system::error_code ec;
+                BOOST_TEST_EQ(src.read(
+                    mutable_buffer(buf, sizeof(buf)), ec),
+                        sizeof(buf));
+                src.rewind();
+                BOOST_TEST(read_all(src, 777) == s);
+
+                // rewind at eof
+                src.rewind();
+                BOOST_TEST(read_all(src, 4096) == s);
+            }
+
+            // destroy with reads in flight
+            {
+                uring_read_source src(f.path.c_str(), opt);
+                char buf[10];
+                system::error_code ec;
+                src.read(mutable_buffer(buf, sizeof(buf)), ec);
+            }
+        }
+
+        // any_read_source
+        {
+            auto src = make_any_read_source(
+                uring_read_source(f.path.c_str()));
+            any_read_source& ar = src;
+            BOOST_TEST(ar.has_size());
+            BOOST_TEST_EQ(ar.size(), s.size());
+            BOOST_TEST(read_all(ar, 1234) == s);
+            ar.rewind();
+            BOOST_TEST(read_all(ar, 50000) == s);
+        }
+
+        // empty file
+        {
+            test::temp_file const e("");
+            uring_read_source src(e.path.c_str());
+            BOOST_TEST_EQ(src.size(), 0);
+            BOOST_TEST(read_all(src, 10).empty());
+        }
+
+        // missing file
+        BOOST_TEST_THROWS(
+            uring_read_source("/nonexistent/boost_buffers"),
+            system::system_error);
+
+        // not a regular file
+        BOOST_TEST_THROWS(
+            uring_read_source("/dev/null"),
+            system::system_error);
+        {
+            int fd[2];
+            if(BOOST_TEST_EQ(::pipe(fd), 0))
+            {
+                BOOST_TEST_THROWS(
+                    uring_read_source(fd[0]),
+                    system::system_error);
+                ::close(fd[1]);
+            }
+        }
+
+        // a regular file read as a stream
+        {
+            uring_stream_source src(f.path.c_str());
+            BOOST_TEST(read_all(src, 3000) == s);
+        }
+
+        // move
+        {
+            uring_read_source src0(f.path.c_str());
+            char buf[10];
+            system::error_code ec;
+            src0.read(mutable_buffer(buf, sizeof(buf)), ec);
+            uring_read_source src1(std::move(src0));
+            BOOST_TEST_EQ(src0.size(), 0);
+            BOOST_TEST(! src0.is_uring());
+            src0 = std::move(src1);
+            BOOST_TEST_EQ(src1.size(), 0);
+            src0.rewind();
+            BOOST_TEST(read_all(src0, 512) == s);
+        }
+    }
+
+    void
+    testPipe()
+    {
+        auto const s = make_contents(100000);
+        for(auto const& opt : all_options())
+        {
+            int fd[2];
+            if(! BOOST_TEST_EQ(::pipe(fd), 0))
+                return;
+            uring_stream_source src(fd[0], opt);
+            if(! opt.use_uring)
+                BOOST_TEST(! src.is_uring());
+
+            // the writer delivers the bytes in pieces
+            std::thread t([&s, &fd]
+            {
+                for(std::size_t i = 0; i < s.size(); i += 3000)
+                {
+                    auto const n = (std::min)(
+                        std::size_t(3000), s.size() - i);
+                    if(::write(fd[1], &s[i], n) !=
+                            static_cast<ssize_t>(n))
+                        break;
+                }
+                ::close(fd[1]);
+            });
+            BOOST_TEST(read_all(src, 4000) == s);
+            t.join();
+        }
+
+        // destroy with a read in flight
+        {
+            int fd[2];
+            if(! BOOST_TEST_EQ(::pipe(fd), 0))
+                return;
+            {
+                uring_stream_source src(fd[0]);
+                char c = 'x';
+                BOOST_TEST_EQ(::write(fd[1], &c, 1), 1);
+                system::error_code ec;
+                BOOST_TEST_EQ(src.read(
+                    mutable_buffer(&c, 1), ec), 1);
+            }
+            ::close(fd[1]);
+        }
+    }
+
+    void
+    testAny()
+    {
+        // streams report no size through any_read_source
+        int fd[2];
+        if(! BOOST_TEST_EQ(::pipe(fd), 0))
+            return;
+        auto src = make_any_read_source(
+            uring_stream_source(fd[0]));
+        any_read_source& ar = src;
+        BOOST_TEST(! ar.has_size());
+        BOOST_TEST(! ar.has_rewind());
+        BOOST_TEST_THROWS(ar.size(), std::invalid_argument);
+        BOOST_TEST_THROWS(ar.rewind(), std::invalid_argument);
+        auto const s = make_contents(5000);
+        BOOST_TEST_EQ(::write(fd[1], s.data(), s.size()),
+            static_cast<ssize_t>(s.size()));
+        ::close(fd[1]);
+        BOOST_TEST(read_all(ar, 700) == s);
+
+        // uring_stream_source()
+        {
+            uring_stream_source src0;
+            BOOST_TEST(! src0.is_uring());
+            char c;
+            system::error_code ec;
+            BOOST_TEST_EQ(src0.read(
+                mutable_buffer(&c, 1), ec), 0);
+            BOOST_TEST(ec == error::eof);
+        }
+    }
+
+    void
+    run()
+    {
+        testFile();
+        testPipe();
+        testAny();
+    }
+};
+
+TEST_SUITE(
+    uring_read_source_test,
+    "boost.buffers.uring_read_source");
+
+} // buffers
+} // boost
+
+#endif